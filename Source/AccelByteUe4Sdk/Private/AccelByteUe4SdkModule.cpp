@@ -113,7 +113,7 @@ void FAccelByteUe4SdkModule::ShutdownModule()
 #endif
 	AccelByte::FRegistry::GameTelemetry.Shutdown();
 	AccelByte::FRegistry::Credentials.Shutdown();
-	AccelByte::FRegistry::HttpRetryScheduler.GetHttpCache().ClearCache();
+	AccelByte::FRegistry::HttpRetryScheduler.GetHttpCache().ClearCache(false);
 	AccelByte::FRegistry::HttpRetryScheduler.Shutdown();
 
 	UnregisterSettings();
@@ -19,7 +19,12 @@ CloudSave::CloudSave(Credentials const& InCredentialsRef
 	, Settings const& InSettingsRef
 	, FHttpRetryScheduler& InHttpRef)
 	: FApiBase(InCredentialsRef, InSettingsRef, InHttpRef)
-{}
+{
+	// Records can be large, allow a slow upload to complete
+	FHttpRequestPolicy Policy;
+	Policy.Deadline = 120.0;
+	HttpClient.SetDefaultRequestPolicy(Policy);
+}
 
 CloudSave::~CloudSave()
 {}
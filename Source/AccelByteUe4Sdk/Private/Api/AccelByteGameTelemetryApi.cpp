@@ -23,6 +23,7 @@ GameTelemetry::GameTelemetry(Credentials& InCredentialsRef
 	, CredentialsRef{InCredentialsRef}
 	, ShuttingDown(false)
 {
+	HttpClient.SetDefaultRequestPriority(EAccelByteHttpRequestPriority::Background);
 	CredentialsRef.OnLoginSuccess().AddRaw(this, &GameTelemetry::OnLoginSuccess);
 }
 
@@ -20,7 +20,9 @@ namespace Api
 		Settings const& InSettingsRef,
 		FHttpRetryScheduler& InHttpRef)
 		: FApiBase(InCredentialsRef, InSettingsRef, InHttpRef)
-	{}
+	{
+		HttpClient.SetDefaultRequestPriority(EAccelByteHttpRequestPriority::Background);
+	}
 
 	HeartBeat::~HeartBeat()
 	{
@@ -27,6 +27,18 @@ namespace AccelByte
 {
 namespace Api
 {
+	namespace
+	{
+		// The requests over it time out early, oldest first
+		constexpr int32 MaxPendingRequestNum = 1024;
+		constexpr float PendingRequestSweepPeriod = 1.0f;
+
+		// Outbound requests, overridden with [AccelByteLobby] SendRateLimit, SendRateBurst and MaxQueuedSendBytes
+		constexpr float DefaultSendRateLimit = 10.0f;
+		constexpr int32 DefaultSendRateBurst = 20;
+		constexpr int32 DefaultMaxQueuedSendBytes = 256 * 1024;
+	}
+
 	namespace LobbyRequest
 	{
 		// Party
@@ -486,6 +498,9 @@ void Lobby::Disconnect(bool ForceCleanup)
 		WebSocket->Disconnect(ForceCleanup);
 	}
 
+	// No response comes after a disconnect, the pending requests are dropped without calling their handlers
+	ClearPendingRequests();
+
 	if (GEngine) UE_LOG(LogAccelByteLobby, Display, TEXT("Disconnected"));
 }
 
@@ -503,30 +518,65 @@ void Lobby::SendPing()
 
 	if (WebSocket.IsValid() && WebSocket->IsConnected())
 	{
-		WebSocket->Send(FString());
+		WebSocket->SendPing();
 	}
 }
 
+template <typename DataStruct, typename ResponseCallbackType, typename ErrorCallbackType>
+void HandleResponse(const FString& MessageType
+	, ResponseCallbackType ResponseCallback
+	, ErrorCallbackType ErrorCallback
+	, const FAccelByteLobbyFrame& Frame
+	, const FString& ReceivedMessageType
+	, int lobbyResponseCode
+	, const TMap<FString, FString>& LobbyErrorMessages);
+
 /**
-Helper macro for ErrorHandler, SuccessHandler and IdResponseMap variable name. Made as separate macro to prevent linux-compiler error
+* Model a response is decoded into, the parameter of its response delegate
+*/
+template <typename DelegateType>
+struct TLobbyResponseModel;
+
+template <typename DataStruct>
+struct TLobbyResponseModel<THandler<DataStruct>>
+{
+	typedef DataStruct Type;
+};
+
+/**
+Helper macro for ErrorHandler and SuccessHandler variable name. Made as separate macro to prevent linux-compiler error
 */
-#define ID_RESPONSE_MAP(MessageType) MessageId ## MessageType ## ResponseMap
 #define MESSAGE_ERROR_HANDLER(MessageType) On ## MessageType ## Error
 #define MESSAGE_SUCCESS_HANDLER(MessageType) MessageType ## Response
 
 /**
-* @brief will auto cache MessageId-Response pair into the target map after sending the raw request
+* @brief will add the request to the pending requests with a copy of its response delegate after sending the raw request
 * @see SEND_RAW_REQUEST_CACHED_RESPONSE_RETURNED
 */
 #define SEND_RAW_REQUEST_CACHED_RESPONSE(MessageType, MessageIDPrefix, CustomPayload) \
-	const FString MessageId = SendRawRequest(LobbyRequest::MessageType, Prefix::MessageIDPrefix, CustomPayload); \
+	SEND_RAW_REQUEST_CACHED_RESPONSE_COALESCED(MessageType, MessageIDPrefix, CustomPayload, FString()) \
+
+/**
+* @brief will add the request to the pending requests with a copy of its response delegate after sending the raw request
+* @param CoalescingKey - a request replaces the queued request with the same key, whose error handler is then called with ErrorCodes::WebSocketRequestSuperseded
+*/
+#define SEND_RAW_REQUEST_CACHED_RESPONSE_COALESCED(MessageType, MessageIDPrefix, CustomPayload, CoalescingKey) \
+	const FString MessageId = SendRawRequest(LobbyRequest::MessageType, Prefix::MessageIDPrefix, CustomPayload, CoalescingKey); \
 	if (!MessageId.IsEmpty()) \
 	{ \
-		ID_RESPONSE_MAP(MessageType).Emplace(MessageId, MESSAGE_SUCCESS_HANDLER(MessageType)); \
+		AddPendingRequest(MessageId, LobbyResponse::MessageType \
+			, [this, OnResponse = MESSAGE_SUCCESS_HANDLER(MessageType)](const FAccelByteLobbyFrame& Frame, const FString& ReceivedMessageType, int32 ResponseCode) \
+			{ \
+				HandleResponse<TLobbyResponseModel<decltype(OnResponse)>::Type>(LobbyResponse::MessageType, OnResponse, MESSAGE_ERROR_HANDLER(MessageType), Frame, ReceivedMessageType, ResponseCode, LobbyErrorMessages); \
+			} \
+			, [this](int32 ErrorCode) \
+			{ \
+				MESSAGE_ERROR_HANDLER(MessageType).ExecuteIfBound(ErrorCode, ErrorMessages::Default.at(ErrorCode)); \
+			}); \
 	} \
 
 /**
-* @brief will auto cache MessageId-Response pair into the target map after sending the raw request
+* @brief will add the request to the pending requests with a copy of its response delegate after sending the raw request
 * @param MessageType - request message type
 * @return MessageId
 */
@@ -534,6 +584,14 @@ Helper macro for ErrorHandler, SuccessHandler and IdResponseMap variable name. M
 	SEND_RAW_REQUEST_CACHED_RESPONSE(MessageType, MessageIDPrefix, CustomPayload) \
 	return MessageId; \
 
+/**
+* @brief will add the request to the pending requests with a copy of its response delegate after sending or queueing the coalesced raw request
+* @return MessageId
+*/
+#define SEND_RAW_REQUEST_CACHED_RESPONSE_COALESCED_RETURNED(MessageType, MessageIDPrefix, CustomPayload, CoalescingKey) \
+	SEND_RAW_REQUEST_CACHED_RESPONSE_COALESCED(MessageType, MessageIDPrefix, CustomPayload, CoalescingKey) \
+	return MessageId; \
+
 //-------------------------------------------------------------------------------------------------
 // Chat
 //-------------------------------------------------------------------------------------------------
@@ -747,9 +805,11 @@ FString Lobby::SendSetPresenceStatus(const EAvailability Availability
 {
 	FReport::Log(FString(__FUNCTION__));
 	const FString EscapedActivity = MessageParser::EscapeString(Activity);
-	SEND_RAW_REQUEST_CACHED_RESPONSE_RETURNED(SetUserPresence
+	// Only the latest presence is sent
+	SEND_RAW_REQUEST_CACHED_RESPONSE_COALESCED_RETURNED(SetUserPresence
 		, Presence
-		, FString::Printf(TEXT("availability: %s\nactivity: %s\n"), *FAccelByteUtilities::GetUEnumValueAsString(Availability).ToLower(), *EscapedActivity))
+		, FString::Printf(TEXT("availability: %s\nactivity: %s\n"), *FAccelByteUtilities::GetUEnumValueAsString(Availability).ToLower(), *EscapedActivity)
+		, LobbyRequest::SetUserPresence)
 }
 
 FString Lobby::SendGetOnlineUsersRequest()
@@ -1364,9 +1424,11 @@ FString Lobby::SetSessionAttribute(const FString& Key
 {
 	FReport::Log(FString(__FUNCTION__));
 
-	SEND_RAW_REQUEST_CACHED_RESPONSE_RETURNED(SetSessionAttribute
+	// Only the latest value of an attribute is sent
+	SEND_RAW_REQUEST_CACHED_RESPONSE_COALESCED_RETURNED(SetSessionAttribute
 		, Attribute
-		, FString::Printf(TEXT("namespace: %s\nkey: %s\nvalue: %s"), *CredentialsRef.GetNamespace(), *Key, *Value));
+		, FString::Printf(TEXT("namespace: %s\nkey: %s\nvalue: %s"), *CredentialsRef.GetNamespace(), *Key, *Value)
+		, LobbyRequest::SetSessionAttribute + TEXT(":") + Key);
 }
 
 FString Lobby::GetSessionAttribute(const FString& Key)
@@ -1675,7 +1737,8 @@ void Lobby::OnClosed(int32 StatusCode
 	
 FString Lobby::SendRawRequest(const FString& MessageType
 	, const FString& MessageIDPrefix
-	, const FString& CustomPayload)
+	, const FString& CustomPayload
+	, const FString& CoalescingKey)
 {
 	if (WebSocket.IsValid() && WebSocket->IsConnected())
 	{
@@ -1685,16 +1748,139 @@ FString Lobby::SendRawRequest(const FString& MessageType
 		{
 			Content.Append(FString::Printf(TEXT("\n%s"), *CustomPayload));
 		}
-		WebSocket->Send(Content);
+		if (CoalescingKey.IsEmpty())
+		{
+			WebSocket->Send(Content);
+		}
+		else
+		{
+			WebSocket->Send(Content, CoalescingKey);
+		}
 		UE_LOG(LogAccelByteLobby, Display, TEXT("Sending request: %s"), *Content);
 		return MessageID;
 	}
 	return TEXT("");
 }
 
-FString Lobby::GenerateMessageID(const FString& Prefix) const
+FString Lobby::GenerateMessageID(const FString& Prefix)
+{
+	// Never reused by this lobby, so a late response can't be matched to a newer request
+	return FString::Printf(TEXT("%s-%llu"), *Prefix, ++LastMessageId);
+}
+
+void Lobby::OnMessageSuperseded(const FString& Message)
+{
+	// Never sent so never answered, the caller learns that a newer request took its place
+	const FAccelByteLobbyFrame Frame(Message);
+	FPendingRequest Request;
+	if (PendingRequests.RemoveAndCopyValue(Frame.GetStringField(TEXT("id")), Request))
+	{
+		Request.Expire(static_cast<int32>(ErrorCodes::WebSocketRequestSuperseded));
+	}
+}
+
+void Lobby::OnMessageDropped(const FString& Message)
+{
+	// Never sent so never answered, failed right away instead of waiting for the timeout
+	const FAccelByteLobbyFrame Frame(Message);
+	FPendingRequest Request;
+	if (PendingRequests.RemoveAndCopyValue(Frame.GetStringField(TEXT("id")), Request))
+	{
+		Request.Expire(static_cast<int32>(ErrorCodes::WebSocketRequestNotSent));
+	}
+}
+
+int32 Lobby::GetSendQueueNum() const
+{
+	return WebSocket.IsValid() ? WebSocket->GetSendQueueNum() : 0;
+}
+
+int32 Lobby::GetSendQueueBytes() const
+{
+	return WebSocket.IsValid() ? WebSocket->GetSendQueueBytes() : 0;
+}
+
+void Lobby::SetRequestTimeout(FTimespan Timeout)
 {
-	return FString::Printf(TEXT("%s-%d"), *Prefix, FMath::RandRange(1000, 9999));
+	RequestTimeout = Timeout > FTimespan::Zero() ? Timeout : FTimespan(0, 1, 0);
+}
+
+void Lobby::AddPendingRequest(const FString& MessageId
+	, const FString& ResponseType
+	, TFunction<void(const FAccelByteLobbyFrame& Frame, const FString& ReceivedMessageType, int32 ResponseCode)>&& Respond
+	, TFunction<void(int32 ErrorCode)>&& Expire)
+{
+	// Bounds the memory when the server stops answering, the oldest request times out early
+	if (PendingRequests.Num() >= MaxPendingRequestNum)
+	{
+		const FString* OldestMessageId = nullptr;
+		double OldestDeadline = TNumericLimits<double>::Max();
+		for (const TPair<FString, FPendingRequest>& Pair : PendingRequests)
+		{
+			if (Pair.Value.Deadline < OldestDeadline)
+			{
+				OldestDeadline = Pair.Value.Deadline;
+				OldestMessageId = &Pair.Key;
+			}
+		}
+
+		if (OldestMessageId != nullptr)
+		{
+			FPendingRequest Oldest;
+			PendingRequests.RemoveAndCopyValue(*OldestMessageId, Oldest);
+			UE_LOG(LogAccelByteLobby, Warning, TEXT("Too many pending requests, %s is timed out early"), *Oldest.ResponseType);
+			Oldest.Expire(static_cast<int32>(ErrorCodes::WebSocketRequestTimeout));
+		}
+	}
+
+	PendingRequests.Emplace(MessageId, FPendingRequest{ ResponseType, FPlatformTime::Seconds() + RequestTimeout.GetTotalSeconds(), MoveTemp(Respond), MoveTemp(Expire) });
+
+	if (!PendingRequestSweepHandle.IsValid())
+	{
+		PendingRequestSweepHandle = FTickerAlias::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(this, &Lobby::SweepPendingRequests),
+			PendingRequestSweepPeriod);
+	}
+}
+
+bool Lobby::SweepPendingRequests(float DeltaTime)
+{
+	const double CurrentTime = FPlatformTime::Seconds();
+
+	TArray<FPendingRequest> ExpiredRequests;
+	for (auto It = PendingRequests.CreateIterator(); It; ++It)
+	{
+		if (It->Value.Deadline <= CurrentTime)
+		{
+			ExpiredRequests.Add(MoveTemp(It->Value));
+			It.RemoveCurrent();
+		}
+	}
+
+	// The handlers are called after the sweep, they might send new requests
+	for (FPendingRequest& Request : ExpiredRequests)
+	{
+		UE_LOG(LogAccelByteLobby, Warning, TEXT("Request timed out waiting for %s"), *Request.ResponseType);
+		Request.Expire(static_cast<int32>(ErrorCodes::WebSocketRequestTimeout));
+	}
+
+	if (PendingRequests.Num() == 0)
+	{
+		PendingRequestSweepHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+void Lobby::ClearPendingRequests()
+{
+	PendingRequests.Reset();
+
+	if (PendingRequestSweepHandle.IsValid())
+	{
+		FTickerAlias::GetCoreTicker().RemoveTicker(PendingRequestSweepHandle);
+		PendingRequestSweepHandle.Reset();
+	}
 }
 
 void Lobby::CreateWebSocket(const FString& Token)
@@ -1726,96 +1912,26 @@ void Lobby::CreateWebSocket(const FString& Token)
 	WebSocket->OnMessageReceived().AddRaw(this, &Lobby::OnMessage);
 	WebSocket->OnConnectionError().AddRaw(this, &Lobby::OnConnectionError);
 	WebSocket->OnConnectionClosed().AddRaw(this, &Lobby::OnClosed);
+	WebSocket->OnMessageSuperseded().AddRaw(this, &Lobby::OnMessageSuperseded);
+	WebSocket->OnMessageDropped().AddRaw(this, &Lobby::OnMessageDropped);
+	WebSocket->OnSendQueueFull().AddLambda([this](bool bIsFull)
+	{
+		SendQueueFull.ExecuteIfBound(bIsFull);
+	});
+
+	float SendRateLimit = DefaultSendRateLimit;
+	int32 SendRateBurst = DefaultSendRateBurst;
+	int32 MaxQueuedSendBytes = DefaultMaxQueuedSendBytes;
+	GConfig->GetFloat(TEXT("AccelByteLobby"), TEXT("SendRateLimit"), SendRateLimit, GEngineIni);
+	GConfig->GetInt(TEXT("AccelByteLobby"), TEXT("SendRateBurst"), SendRateBurst, GEngineIni);
+	GConfig->GetInt(TEXT("AccelByteLobby"), TEXT("MaxQueuedSendBytes"), MaxQueuedSendBytes, GEngineIni);
+	WebSocket->SetSendRateLimit(SendRateLimit, SendRateBurst);
+	WebSocket->SetMaxQueuedSendBytes(MaxQueuedSendBytes);
 }
 
 FString Lobby::LobbyMessageToJson(const FString& Message)
 {
-	bool bFirst = true;
-	FString JsonString = TEXT("{");
-	TArray<FString> Lines;
-	Message.ParseIntoArray(Lines, TEXT("\n"), true);
-	for (const auto& Line : Lines)
-	{
-		FString Name;
-		FString Value;
-		if (bFirst)
-		{
-			bFirst = false;
-		}
-		else
-		{
-			JsonString.Append(",");
-		}
-		Line.Split(": ", &Name, &Value);
-		JsonString.Appendf(TEXT("\"%s\":"), *Name);
-
-		Value.TrimStartAndEndInline();
-
-		const TCHAR* Cursor = GetData(Value);
-
-		if (Cursor == nullptr)
-		{
-			JsonString.Append("null");
-			continue;
-		}
-		
-		// make sure it's null terminated
-		checkf(*(Cursor + Value.Len()) == 0, TEXT("Invalid value: '%s' length: %d"), *Value, Value.Len());
-
-		// Array
-		if (*Cursor == '[')
-		{
-			++Cursor;
-			// skip spaces
-			while (*Cursor && *Cursor == ' ') ++Cursor;
-			bool bWasArrayParsed;
-			FString JsonArrayString;
-			// array of JSON object
-			if (*Cursor == '{')
-			{
-				bWasArrayParsed = MessageParser::ParseArrayOfObject(Cursor, JsonArrayString);
-			}
-			// array of string
-			else
-			{
-				bWasArrayParsed = MessageParser::ParseArrayOfString(Cursor, JsonArrayString);
-			}
-			
-			if (bWasArrayParsed)
-			{
-				JsonString.Append(JsonArrayString);
-			}
-			else
-			{
-				// if the array was not parsed, set to empty array
-				JsonString.Append("[]");
-				UE_LOG(LogAccelByte, Warning, TEXT("[LobbyMessageToJson] Invalid array for field '%s', set to empty array"), *Name);
-			}
-		}
-		// JSON
-		else if (*Cursor == '{')
-		{
-			FString ObjectString;
-			// only append valid object
-			if (MessageParser::ParseObject(Cursor, ObjectString))
-			{
-				JsonString.Append(ObjectString);
-			}
-			else
-			{
-				JsonString.Append("{}");
-				UE_LOG(LogAccelByte, Warning, TEXT("[LobbyMessageToJson] Invalid object for field '%s', set to empty object"), *Name);
-			}
-		}
-		// everything else
-		else
-		{
-			MessageParser::ParseString(Cursor, JsonString);
-		}
-	}
-
-	JsonString += TEXT("}");
-	return JsonString;
+	return FAccelByteLobbyFrame(Message).ToJsonString();
 }
 
 /**
@@ -1826,19 +1942,32 @@ template <typename DataStruct, typename ResponseCallbackType, typename ErrorCall
 void HandleResponse(const FString& MessageType
 	, ResponseCallbackType ResponseCallback
 	, ErrorCallbackType ErrorCallback
-	, const FString& ParsedJsonString
+	, const FAccelByteLobbyFrame& Frame
 	, const FString& ReceivedMessageType
 	, int lobbyResponseCode
 	, const TMap<FString, FString>& LobbyErrorMessages)
 {
 	ensure(ReceivedMessageType.Equals(MessageType));
+
+	// Nobody is waiting for the response, the body is left unparsed
+	if (!ResponseCallback.IsBound() && !ErrorCallback.IsBound())
+	{
+		return;
+	}
+
 	DataStruct Result;
 	bool bSuccess = false;
 	if (lobbyResponseCode == 0)
 	{
-		bSuccess = FAccelByteJsonConverter::JsonObjectStringToUStruct(ParsedJsonString, &Result);
+		bSuccess = FAccelByteLobbyFrameDecoder::Decode(Frame, Result);
+		if (!bSuccess)
+		{
+			UE_LOG(LogAccelByteLobby, Display, TEXT("Failed to decode %s. Raw: %s"), *MessageType, *Frame.GetMessage());
+			lobbyResponseCode = static_cast<int>(ErrorCodes::JsonDeserializationFailed);
+		}
 	}
-	else
+
+	if (lobbyResponseCode != 0)
 	{
 		const FString ErrorCodeString = FString::FromInt(lobbyResponseCode);
 
@@ -1884,28 +2013,21 @@ void HandleResponse(const FString& MessageType
 #define CASE_RESPONSE(MessageType, Model) \
 	case (Response::MessageType) : \
 		{ \
-			HandleResponse<Model>(LobbyResponse::MessageType, MESSAGE_SUCCESS_HANDLER(MessageType), MESSAGE_ERROR_HANDLER(MessageType), ParsedJsonString, ReceivedMessageType, lobbyResponseCode, LobbyErrorMessages);\
+			HandleResponse<Model>(LobbyResponse::MessageType, MESSAGE_SUCCESS_HANDLER(MessageType), MESSAGE_ERROR_HANDLER(MessageType), Frame, ReceivedMessageType, lobbyResponseCode, LobbyErrorMessages);\
 			break; \
 		} \
 
 /**
-* Some delegate types can be derived from MessageType
+* @brief convenient switch case for RESPONSE context; will answer the pending request with the received message id,
+* its response delegate is the one copied when the request was sent
 */
-#define DELEGATE_TYPE(MessageType) F ## MessageType ## Response
-
-/**
-* @brief convenient switch case for RESPONSE context; will cache the (MessageId,SuccessDelegate) pair
-* @param DelegateType explicit param for cases/responses that has different format naming between MessageType and DelegateType
-*/
-#define CASE_RESPONSE_MESSAGE_ID_DELEGATE_TYPE(MessageType, Model, DelegateType) \
+#define CASE_RESPONSE_MESSAGE_ID(MessageType) \
 	case (Response::MessageType) : \
 		{ \
-			if(ID_RESPONSE_MAP(MessageType).Contains(ReceivedMessageId)) \
+			FPendingRequest Request; \
+			if (!ReceivedMessageId.IsEmpty() && PendingRequests.RemoveAndCopyValue(ReceivedMessageId, Request)) \
 			{ \
-				DelegateType* IdResponse = ID_RESPONSE_MAP(MessageType).Find(ReceivedMessageId); \
-				check(IdResponse); \
-				HandleResponse<Model>(LobbyResponse::MessageType, *IdResponse, MESSAGE_ERROR_HANDLER(MessageType), ParsedJsonString, ReceivedMessageType, lobbyResponseCode, LobbyErrorMessages);\
-				ID_RESPONSE_MAP(MessageType).Remove(ReceivedMessageId); \
+				Request.Respond(Frame, ReceivedMessageType, lobbyResponseCode); \
 			} \
 			else \
 			{ \
@@ -1914,27 +2036,11 @@ void HandleResponse(const FString& MessageType
 			break; \
 		} \
 
-//@brief convenient switch case for RESPONSE context; will cache the (MessageId,SuccessDelegate) pair
-#define CASE_RESPONSE_MESSAGE_ID(MessageType, Model) CASE_RESPONSE_MESSAGE_ID_DELEGATE_TYPE(MessageType, Model, DELEGATE_TYPE(MessageType))
-
 void Lobby::HandleMessageResponse(const FString& ReceivedMessageType
-	, const FString& ParsedJsonString
-	, const TSharedPtr<FJsonObject>& ParsedJsonObj
-	, const TSharedPtr<FLobbyMessageMetaData>& MessageMeta = nullptr)
+	, const FAccelByteLobbyFrame& Frame)
 {
-	int lobbyResponseCode{0};
-	FString ReceivedMessageId{};
-
-	if(MessageMeta.IsValid())
-	{
-		lobbyResponseCode = FCString::Atoi(*MessageMeta->Code);
-		ReceivedMessageId = MessageMeta->Id;
-	}
-	else
-	{
-		lobbyResponseCode = ParsedJsonObj->GetIntegerField("code");
-		ReceivedMessageId = ParsedJsonObj->GetStringField("id");
-	}
+	const int lobbyResponseCode = Frame.GetIntegerField(TEXT("code"));
+	const FString ReceivedMessageId = Frame.GetStringField(TEXT("id"));
 
 	Response ResponseEnum = Response::Invalid_Response;
 	Response* ResponseEnumPointer = ResponseStringEnumMap.Find(ReceivedMessageType);
@@ -1946,27 +2052,28 @@ void Lobby::HandleMessageResponse(const FString& ReceivedMessageType
 	switch (ResponseEnum)
 	{
 		// Party
-		CASE_RESPONSE_MESSAGE_ID(PartyInfo			, FAccelByteModelsInfoPartyResponse);
-		CASE_RESPONSE_MESSAGE_ID(PartyCreate		, FAccelByteModelsCreatePartyResponse);
-		CASE_RESPONSE_MESSAGE_ID(PartyLeave			, FAccelByteModelsLeavePartyResponse);
-		CASE_RESPONSE_MESSAGE_ID(PartyInvite		, FAccelByteModelsPartyInviteResponse);
-		CASE_RESPONSE_MESSAGE_ID(PartyJoin			, FAccelByteModelsPartyJoinResponse);
-		CASE_RESPONSE_MESSAGE_ID(PartyReject		, FAccelByteModelsPartyRejectResponse);
-		CASE_RESPONSE_MESSAGE_ID(PartyKick			, FAccelByteModelsKickPartyMemberResponse);
-		CASE_RESPONSE_MESSAGE_ID(PartyGetCode		, FAccelByteModelsPartyGetCodeResponse);
-		CASE_RESPONSE_MESSAGE_ID(PartyGenerateCode	, FAccelByteModelsPartyGenerateCodeResponse);
-		CASE_RESPONSE_MESSAGE_ID(PartyDeleteCode	, FAccelByteModelsPartyDeleteCodeResponse);
-		CASE_RESPONSE_MESSAGE_ID(PartyJoinViaCode	, FAccelByteModelsPartyJoinResponse);
-		CASE_RESPONSE_MESSAGE_ID(PartyPromoteLeader	, FAccelByteModelsPartyPromoteLeaderResponse);
-		CASE_RESPONSE_MESSAGE_ID(PartySendNotif		, FAccelByteModelsPartySendNotifResponse);
+		CASE_RESPONSE_MESSAGE_ID(PartyInfo);
+		CASE_RESPONSE_MESSAGE_ID(PartyCreate);
+		CASE_RESPONSE_MESSAGE_ID(PartyLeave);
+		CASE_RESPONSE_MESSAGE_ID(PartyInvite);
+		CASE_RESPONSE_MESSAGE_ID(PartyJoin);
+		CASE_RESPONSE_MESSAGE_ID(PartyReject);
+		CASE_RESPONSE_MESSAGE_ID(PartyKick);
+		CASE_RESPONSE_MESSAGE_ID(PartyGetCode);
+		CASE_RESPONSE_MESSAGE_ID(PartyGenerateCode);
+		CASE_RESPONSE_MESSAGE_ID(PartyDeleteCode);
+		CASE_RESPONSE_MESSAGE_ID(PartyJoinViaCode);
+		CASE_RESPONSE_MESSAGE_ID(PartyPromoteLeader);
+		CASE_RESPONSE_MESSAGE_ID(PartySendNotif);
 		// Chat
-		CASE_RESPONSE_MESSAGE_ID(PersonalChat	, FAccelByteModelsPersonalMessageResponse);
-		CASE_RESPONSE_MESSAGE_ID(PartyChat		, FAccelByteModelsPartyMessageResponse);
-		CASE_RESPONSE_MESSAGE_ID(ChannelChat	, FAccelByteModelsChannelMessageResponse);
+		CASE_RESPONSE_MESSAGE_ID(PersonalChat);
+		CASE_RESPONSE_MESSAGE_ID(PartyChat);
+		CASE_RESPONSE_MESSAGE_ID(ChannelChat);
 		case (Response::JoinChannelChat):
 		{
+			// Decoded even without a listener, the channel slug is kept for the chat requests
 			FAccelByteModelsJoinDefaultChannelResponse Result;
-			if (const bool bParseSuccess = FAccelByteJsonConverter::JsonObjectStringToUStruct(ParsedJsonString, &Result))
+			if (const bool bParseSuccess = FAccelByteLobbyFrameDecoder::Decode(Frame, Result))
 			{
 				ChannelSlug = Result.ChannelSlug;
 				JoinDefaultChannelChatResponse.ExecuteIfBound(Result);
@@ -1974,31 +2081,36 @@ void Lobby::HandleMessageResponse(const FString& ReceivedMessageType
 			break;
 		}
 		// Presence
-		CASE_RESPONSE_MESSAGE_ID(SetUserPresence	, FAccelByteModelsSetOnlineUsersResponse);
-		CASE_RESPONSE_MESSAGE_ID(GetAllFriendsStatus, FAccelByteModelsGetOnlineUsersResponse);
+		CASE_RESPONSE_MESSAGE_ID(SetUserPresence);
+		CASE_RESPONSE_MESSAGE_ID(GetAllFriendsStatus);
 		// Matchmaking
-		CASE_RESPONSE_MESSAGE_ID_DELEGATE_TYPE(MatchmakingStart	, FAccelByteModelsMatchmakingResponse, FMatchmakingResponse);
-		CASE_RESPONSE_MESSAGE_ID_DELEGATE_TYPE(MatchmakingCancel, FAccelByteModelsMatchmakingResponse, FMatchmakingResponse);
-		CASE_RESPONSE_MESSAGE_ID(ReadyConsent, FAccelByteModelsReadyConsentRequest);
-		CASE_RESPONSE_MESSAGE_ID(RejectConsent, FAccelByteModelsRejectConsentRequest);
+		CASE_RESPONSE_MESSAGE_ID(MatchmakingStart);
+		CASE_RESPONSE_MESSAGE_ID(MatchmakingCancel);
+		CASE_RESPONSE_MESSAGE_ID(ReadyConsent);
+		CASE_RESPONSE_MESSAGE_ID(RejectConsent);
 		// Custom Game
-		CASE_RESPONSE_MESSAGE_ID_DELEGATE_TYPE(CreateDS			, FAccelByteModelsLobbyBaseResponse, FBaseResponse);
+		CASE_RESPONSE_MESSAGE_ID(CreateDS);
 		// Friends
-		CASE_RESPONSE_MESSAGE_ID(RequestFriends		, FAccelByteModelsRequestFriendsResponse);
-		CASE_RESPONSE_MESSAGE_ID_DELEGATE_TYPE(RequestFriendsByPublicId		, FAccelByteModelsRequestFriendsResponse, FRequestFriendsResponse);
-		CASE_RESPONSE_MESSAGE_ID(Unfriend			, FAccelByteModelsUnfriendResponse);
-		CASE_RESPONSE_MESSAGE_ID(ListOutgoingFriends, FAccelByteModelsListOutgoingFriendsResponse);
-		CASE_RESPONSE_MESSAGE_ID(ListOutgoingFriendsWithTime, FAccelByteModelsListOutgoingFriendsWithTimeResponse);
-		CASE_RESPONSE_MESSAGE_ID(CancelFriends		, FAccelByteModelsCancelFriendsResponse);
-		CASE_RESPONSE_MESSAGE_ID(ListIncomingFriends, FAccelByteModelsListIncomingFriendsResponse);
-		CASE_RESPONSE_MESSAGE_ID(ListIncomingFriendsWithTime, FAccelByteModelsListIncomingFriendsWithTimeResponse);
-		CASE_RESPONSE_MESSAGE_ID(AcceptFriends		, FAccelByteModelsAcceptFriendsResponse);
-		CASE_RESPONSE_MESSAGE_ID(RejectFriends		, FAccelByteModelsRejectFriendsResponse);
-		CASE_RESPONSE_MESSAGE_ID(LoadFriendList		, FAccelByteModelsLoadFriendListResponse);
+		CASE_RESPONSE_MESSAGE_ID(RequestFriends);
+		CASE_RESPONSE_MESSAGE_ID(RequestFriendsByPublicId);
+		CASE_RESPONSE_MESSAGE_ID(Unfriend);
+		CASE_RESPONSE_MESSAGE_ID(ListOutgoingFriends);
+		CASE_RESPONSE_MESSAGE_ID(ListOutgoingFriendsWithTime);
+		CASE_RESPONSE_MESSAGE_ID(CancelFriends);
+		CASE_RESPONSE_MESSAGE_ID(ListIncomingFriends);
+		CASE_RESPONSE_MESSAGE_ID(ListIncomingFriendsWithTime);
+		CASE_RESPONSE_MESSAGE_ID(AcceptFriends);
+		CASE_RESPONSE_MESSAGE_ID(RejectFriends);
+		CASE_RESPONSE_MESSAGE_ID(LoadFriendList);
 		case (Response::GetFriendshipStatus):
 		{
+			if (!GetFriendshipStatusResponse.IsBound())
+			{
+				break;
+			}
+
 			FAccelByteModelsGetFriendshipStatusStringResponse StringResult;
-			bool bParseSuccess = FAccelByteJsonConverter::JsonObjectStringToUStruct(ParsedJsonString, &StringResult);
+			bool bParseSuccess = FAccelByteLobbyFrameDecoder::Decode(Frame, StringResult);
 			if (bParseSuccess)
 			{
 				FAccelByteModelsGetFriendshipStatusResponse Result;
@@ -2009,29 +2121,32 @@ void Lobby::HandleMessageResponse(const FString& ReceivedMessageType
 			break;
 		}
 		// Block
-		CASE_RESPONSE_MESSAGE_ID(BlockPlayer	, FAccelByteModelsBlockPlayerResponse);
-		CASE_RESPONSE_MESSAGE_ID(UnblockPlayer	, FAccelByteModelsUnblockPlayerResponse);
+		CASE_RESPONSE_MESSAGE_ID(BlockPlayer);
+		CASE_RESPONSE_MESSAGE_ID(UnblockPlayer);
 		// Session Attribute
-		CASE_RESPONSE_MESSAGE_ID(SetSessionAttribute	, FAccelByteModelsSetSessionAttributesResponse);
-		CASE_RESPONSE_MESSAGE_ID(GetSessionAttribute	, FAccelByteModelsGetSessionAttributesResponse);
-		CASE_RESPONSE_MESSAGE_ID(GetAllSessionAttribute	, FAccelByteModelsGetAllSessionAttributesResponse);
-		CASE_RESPONSE_MESSAGE_ID(RefreshToken			, FAccelByteModelsRefreshTokenResponse);
+		CASE_RESPONSE_MESSAGE_ID(SetSessionAttribute);
+		CASE_RESPONSE_MESSAGE_ID(GetSessionAttribute);
+		CASE_RESPONSE_MESSAGE_ID(GetAllSessionAttribute);
+		CASE_RESPONSE_MESSAGE_ID(RefreshToken);
 		default:
 		{
-			ParsingError.ExecuteIfBound(-1, FString::Printf(TEXT("Error; Detected of type Response but no specific handler case assigned. %s, Raw: %s"), *ReceivedMessageType, *ParsedJsonString));
+			ParsingError.ExecuteIfBound(-1, FString::Printf(TEXT("Error; Detected of type Response but no specific handler case assigned. %s, Raw: %s"), *ReceivedMessageType, *Frame.GetMessage()));
 			break;
 		}
 
 	}
+
+	// Answered, a request whose response has no case above is no longer waited for
+	if (!ReceivedMessageId.IsEmpty())
+	{
+		PendingRequests.Remove(ReceivedMessageId);
+	}
 }
 
 #undef MESSAGE_SUCCESS_HANDLER
 #undef MESSAGE_ERROR_HANDLER
 #undef CASE_RESPONSE
 #undef CASE_RESPONSE_MESSAGE_ID
-#undef ID_RESPONSE_MAP
-#undef DELEGATE_TYPE
-#undef CASE_RESPONSE_MESSAGE_ID_DELEGATE_TYPE
 
 /**
 * Default Notif handler as templated function (compile time checked)
@@ -2040,12 +2155,19 @@ void Lobby::HandleMessageResponse(const FString& ReceivedMessageType
 template <typename DataStruct, typename ResponseCallbackType>
 void HandleNotif(const FString& MessageType
 	, ResponseCallbackType ResponseCallback
-	, const FString& ParsedJsonString
+	, const FAccelByteLobbyFrame& Frame
 	, const FString& ReceivedMessageType)
 {
 	ensure(ReceivedMessageType.Equals(MessageType));
+
+	// Nobody listens to the notification, the body is left unparsed
+	if (!ResponseCallback.IsBound())
+	{
+		return;
+	}
+
 	DataStruct Result;
-	if (const bool bSuccess = FAccelByteJsonConverter::JsonObjectStringToUStruct(ParsedJsonString, &Result)) {
+	if (const bool bSuccess = FAccelByteLobbyFrameDecoder::Decode(Frame, Result)) {
 		ResponseCallback.ExecuteIfBound(Result);
 	}
 
@@ -2059,7 +2181,7 @@ void HandleNotif(const FString& MessageType
 #define CASE_NOTIF(MessageType, Model) \
 	case (Notif::MessageType) : \
 		{ \
-			HandleNotif<Model>(LobbyResponse::MessageType, MessageType, ParsedJsonString, ReceivedMessageType);\
+			HandleNotif<Model>(LobbyResponse::MessageType, MessageType, Frame, ReceivedMessageType);\
 			break; \
 		} \
 		
@@ -2087,12 +2209,12 @@ void DispatchV2JsonNotif(const FString& Payload
 	}
 }
 
-void Lobby::HandleV2SessionNotif(const FString& ParsedJsonString)
+void Lobby::HandleV2SessionNotif(const FAccelByteLobbyFrame& Frame)
 {
 	FAccelByteModelsSessionNotificationMessage Notif;
-	if (FAccelByteJsonConverter::JsonObjectStringToUStruct(ParsedJsonString, &Notif) == false)
+	if (FAccelByteLobbyFrameDecoder::Decode(Frame, Notif) == false)
 	{
-		UE_LOG(LogAccelByteLobby, Log, TEXT("Cannot deserialize sessionMessageNotif to struct\nNotification: %s"), *ParsedJsonString);
+		UE_LOG(LogAccelByteLobby, Log, TEXT("Cannot deserialize sessionMessageNotif to struct\nNotification: %s"), *Frame.GetMessage());
 		return;
 	}
 
@@ -2163,7 +2285,7 @@ void Lobby::HandleV2SessionNotif(const FString& ParsedJsonString)
 		DispatchV2JsonNotif<FAccelByteModelsV2GameSession>(Notif.Payload, V2GameSessionUpdatedNotif);
 		break;
 	}
-	default: UE_LOG(LogAccelByteLobby, Log, TEXT("Unknown session notification topic\nNotification: %s"), *ParsedJsonString);
+	default: UE_LOG(LogAccelByteLobby, Log, TEXT("Unknown session notification topic\nNotification: %s"), *Frame.GetMessage());
 	}
 }
 
@@ -2208,8 +2330,7 @@ void Lobby::InitializeV2MatchmakingNotifDelegates()
 }
 
 void Lobby::HandleMessageNotif(const FString& ReceivedMessageType
-	, const FString& ParsedJsonString
-	, const TSharedPtr<FJsonObject>& ParsedJsonObj)
+	, const FAccelByteLobbyFrame& Frame)
 {
 	Notif NotifEnum = Notif::Invalid_Notif;
 	if (const Notif* NotifEnumPointer = NotifStringEnumMap.Find(ReceivedMessageType))
@@ -2223,7 +2344,7 @@ void Lobby::HandleMessageNotif(const FString& ReceivedMessageType
 		case (Notif::ConnectedNotif):
 		{
 			FAccelByteModelsLobbySessionId SessionId;
-			bool bSuccess = FAccelByteJsonConverter::JsonObjectStringToUStruct(ParsedJsonString, &SessionId);
+			bool bSuccess = FAccelByteLobbyFrameDecoder::Decode(Frame, SessionId);
 			if (bSuccess)
 			{
 				LobbySessionId = SessionId;
@@ -2234,8 +2355,13 @@ void Lobby::HandleMessageNotif(const FString& ReceivedMessageType
 		CASE_NOTIF(DisconnectNotif, FAccelByteModelsDisconnectNotif);
 		case (Notif::PartyMemberLeaveNotif):
 		{
+				if (!PartyLeaveNotif.IsBound() && !PartyMemberLeaveNotif.IsBound())
+				{
+					break;
+				}
+
 				FAccelByteModelsLeavePartyNotice PartyLeaveResult;
-				bool bSuccess = FAccelByteJsonConverter::JsonObjectStringToUStruct(ParsedJsonString, &PartyLeaveResult);
+				bool bSuccess = FAccelByteLobbyFrameDecoder::Decode(Frame, PartyLeaveResult);
 				if (bSuccess)
 				{
 					if (PartyLeaveNotif.IsBound())
@@ -2256,6 +2382,20 @@ void Lobby::HandleMessageNotif(const FString& ReceivedMessageType
 		CASE_NOTIF(PartyKickNotif, FAccelByteModelsGotKickedFromPartyNotice);
 		case Notif::PartyNotif:
 		{
+			if (!PartyNotif.IsBound())
+			{
+				break;
+			}
+
+			// The payload object is kept as a string, only this notification goes through JSON
+			const FString ParsedJsonString = Frame.ToJsonString();
+			const TSharedPtr<FJsonObject> ParsedJsonObj = Frame.ToJsonObject();
+			if (!ParsedJsonObj.IsValid())
+			{
+				UE_LOG(LogAccelByteLobby, Log, TEXT("PartyNotif: unable to parse: %s"), *ParsedJsonString);
+				return;
+			}
+
 			const FString PayloadKey(TEXT("payload"));
 			const TSharedPtr<FJsonObject>* ObjectValue;
 			if (ParsedJsonObj->TryGetObjectField(PayloadKey, ObjectValue))
@@ -2291,10 +2431,28 @@ void Lobby::HandleMessageNotif(const FString& ReceivedMessageType
 		// Notification
 		case(Notif::MessageNotif):
 		{
+			// The matchmaking V2 topics have handlers of their own, the other topics only go to MessageNotif
+			const EV2MatchmakingNotifTopic MMNotifEnum = FAccelByteUtilities::GetUEnumValueFromString<EV2MatchmakingNotifTopic>(Frame.GetStringField(TEXT("topic")));
+			const bool bIsMatchmakingV2Notif = MMNotifEnum != EV2MatchmakingNotifTopic::Invalid && MatchmakingV2NotifDelegates.Contains(MMNotifEnum);
+			if (!bIsMatchmakingV2Notif && !MessageNotif.IsBound())
+			{
+				break;
+			}
+
 			FAccelByteModelsNotificationMessage NotificationMessage;
-			FString PayloadKey = "payload";
-			if (ParsedJsonObj->HasTypedField<EJson::Object>(PayloadKey))
+			FStringView PayloadValue;
+			if (Frame.TryGetField(TEXT("payload"), PayloadValue) && PayloadValue.Len() > 0 && *PayloadValue.GetData() == TCHAR('{'))
 			{
+				// The payload object is kept as a string, only this case goes through JSON
+				const FString ParsedJsonString = Frame.ToJsonString();
+				const TSharedPtr<FJsonObject> ParsedJsonObj = Frame.ToJsonObject();
+				const FString PayloadKey = "payload";
+				if (!ParsedJsonObj.IsValid() || !ParsedJsonObj->HasTypedField<EJson::Object>(PayloadKey))
+				{
+					UE_LOG(LogAccelByteLobby, Log, TEXT("Cannot deserialize the whole MessageNotif to the struct\nNotification: %s"), *ParsedJsonString);
+					return;
+				}
+
 				TSharedPtr<FJsonObject> PayloadObject = ParsedJsonObj->GetObjectField(PayloadKey);
 				if (PayloadObject == nullptr)
 				{
@@ -2319,15 +2477,14 @@ void Lobby::HandleMessageNotif(const FString& ReceivedMessageType
 			}
 			else
 			{
-				if (FAccelByteJsonConverter::JsonObjectStringToUStruct(ParsedJsonString, &NotificationMessage) == false)
+				if (FAccelByteLobbyFrameDecoder::Decode(Frame, NotificationMessage) == false)
 				{
-					UE_LOG(LogAccelByteLobby, Log, TEXT("Cannot deserialize the whole MessageNotif to the struct\nNotification: %s"), *ParsedJsonString);
+					UE_LOG(LogAccelByteLobby, Log, TEXT("Cannot deserialize the whole MessageNotif to the struct\nNotification: %s"), *Frame.GetMessage());
 					return;
 				}
 			}
 
-			EV2MatchmakingNotifTopic MMNotifEnum = FAccelByteUtilities::GetUEnumValueFromString<EV2MatchmakingNotifTopic>(NotificationMessage.Topic);
-			if(MMNotifEnum != EV2MatchmakingNotifTopic::Invalid && MatchmakingV2NotifDelegates.Contains(MMNotifEnum))
+			if(bIsMatchmakingV2Notif)
 			{
 				MatchmakingV2NotifDelegates[MMNotifEnum].ExecuteIfBound(NotificationMessage);
 				break;
@@ -2358,7 +2515,7 @@ void Lobby::HandleMessageNotif(const FString& ReceivedMessageType
 			BanNotifReceived = true;
 			FAccelByteModelsUserBannedNotification Result;
 			//CredentialsRef.OnTokenRefreshed().Remove(TokenRefreshDelegateHandle);
-			if (FAccelByteJsonConverter::JsonObjectStringToUStruct(ParsedJsonString, &Result))
+			if (FAccelByteLobbyFrameDecoder::Decode(Frame, Result))
 			{
 				if (Result.UserId == CredentialsRef.GetUserId())
 				{
@@ -2414,7 +2571,7 @@ void Lobby::HandleMessageNotif(const FString& ReceivedMessageType
 		}
 		case (Notif::ErrorNotif):
 		{
-			FString ErrorNotifRequestType = ParsedJsonObj->GetStringField(TEXT("requestType"));
+			FString ErrorNotifRequestType = Frame.GetStringField(TEXT("requestType"));
 
 			// Handle trigger ResponseDelegates when ErrorNotif arrived with "requestType" field 
 			if(!ErrorNotifRequestType.IsEmpty())
@@ -2426,30 +2583,32 @@ void Lobby::HandleMessageNotif(const FString& ReceivedMessageType
 					ErrorNotifRequestType = ErrorNotifRequestType.LeftChop(RequestString.Len()).Append(TEXT("Response"));
 				}
 				
-				FAccelByteModelsLobbyBaseResponse ErrorRequestResponse;
-				ErrorRequestResponse.Code = ParsedJsonObj->GetStringField(TEXT("code"));
-				ErrorRequestResponse.Id = ParsedJsonObj->GetStringField("id");
-				ErrorRequestResponse.Type = ErrorNotifRequestType;
-
-				TSharedPtr<FJsonObject> ErrorRequestJsonObject = FJsonObjectConverter::UStructToJsonObject(ErrorRequestResponse);
-				FString ErrorRequestJsonString;
-				FJsonObjectConverter::UStructToJsonObjectString(ErrorRequestResponse, ErrorRequestJsonString);
-				HandleMessageResponse(ErrorNotifRequestType,  ErrorRequestJsonString, ErrorRequestJsonObject);
+				// Answered as if the response came with the error code
+				const FString ErrorRequestMessage = FString::Printf(TEXT("type: %s\nid: %s\ncode: %s")
+					, *ErrorNotifRequestType
+					, *Frame.GetStringField(TEXT("id"))
+					, *Frame.GetStringField(TEXT("code")));
+				const FAccelByteLobbyFrame ErrorRequestFrame(ErrorRequestMessage);
+				HandleMessageResponse(ErrorNotifRequestType, ErrorRequestFrame);
 			}
 			else
 			{
-				ErrorNotif.ExecuteIfBound(ParsedJsonObj->GetIntegerField(TEXT("code")), ParsedJsonObj->GetStringField(TEXT("message")));
+				ErrorNotif.ExecuteIfBound(Frame.GetIntegerField(TEXT("code")), Frame.GetStringField(TEXT("message")));
 			}
 			break;
 		}
 		case (Notif::SignalingP2PNotif):
 		{
-			SignalingP2PNotif.ExecuteIfBound(ParsedJsonObj->GetStringField(TEXT("destinationId")), ParsedJsonObj->GetStringField(TEXT("message")));
+			if (!SignalingP2PNotif.IsBound())
+			{
+				break;
+			}
+			SignalingP2PNotif.ExecuteIfBound(Frame.GetStringField(TEXT("destinationId")), Frame.GetStringField(TEXT("message")));
 			break;
 		}
 		default:
 		{
-			ParsingError.ExecuteIfBound(-1, FString::Printf(TEXT("Error; Detected of type notif but no specific handler case assigned. %s, Raw: %s"), *ReceivedMessageType, *ParsedJsonString));
+			ParsingError.ExecuteIfBound(-1, FString::Printf(TEXT("Error; Detected of type notif but no specific handler case assigned. %s, Raw: %s"), *ReceivedMessageType, *Frame.GetMessage()));
 			break;
 		}
 	}
@@ -2457,37 +2616,6 @@ void Lobby::HandleMessageNotif(const FString& ReceivedMessageType
 }
 #undef CASE_NOTIF
 
-bool Lobby::ExtractLobbyMessageMetaData(const FString& InLobbyMessage
-	, TSharedRef<FLobbyMessageMetaData>& OutLobbyMessageMetaData)
-{
-	TArray<FString> MessageLines;
-	InLobbyMessage.ParseIntoArrayLines(MessageLines);
-
-	const FString CodeKey {"code: "};
-	const FString TypeKey {"type: "};
-	const FString IdKey {"id: "};
-	
-	for(const FString& Line : MessageLines)
-	{
-		if(Line.StartsWith(CodeKey))
-		{
-			OutLobbyMessageMetaData->Code = Line.RightChop(CodeKey.Len());
-		}
-		else if(Line.StartsWith(TypeKey))
-		{
-			OutLobbyMessageMetaData->Type = Line.RightChop(TypeKey.Len());
-		}
-		else if(Line.StartsWith(IdKey))
-		{
-			OutLobbyMessageMetaData->Id = Line.RightChop(IdKey.Len());
-		}
-	}
-
-	UE_LOG(LogAccelByteLobby, Display, TEXT("Metadata found type %s, id %s, code %s"), *OutLobbyMessageMetaData->Type, *OutLobbyMessageMetaData->Id, *OutLobbyMessageMetaData->Code);
-
-	return true;
-}
-	
 void Lobby::OnMessage(const FString& Message)
 {
 	UE_LOG(LogAccelByteLobby, Display, TEXT("Raw Lobby Response\n%s"), *Message);
@@ -2497,54 +2625,34 @@ void Lobby::OnMessage(const FString& Message)
 		return;
 	}
 
-	// Conversion : Custom -> Json
-	const FString ParsedJsonString = LobbyMessageToJson(Message);
-	
-	UE_LOG(LogAccelByteLobby, Display, TEXT("JSON Version: %s"), *ParsedJsonString);
-
-	TSharedPtr<FJsonObject> ParsedJsonObj;
-	TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ParsedJsonString);
-	if (!FJsonSerializer::Deserialize(JsonReader, ParsedJsonObj))
-	{
-		UE_LOG(LogAccelByteLobby, Display, TEXT("Failed to Deserialize. Json: %s"), *ParsedJsonString);
-
-		TSharedRef<FLobbyMessageMetaData> MetaData = MakeShared<FLobbyMessageMetaData>();
-		ExtractLobbyMessageMetaData(Message, MetaData);
-		MetaData->Code = FString::FromInt(static_cast<int>(ErrorCodes::JsonDeserializationFailed));
-
-		// handle error message if message type is response. if notif then ignore.
-		if (MetaData->Type.Contains(Suffix::Response))
-		{
-			HandleMessageResponse(MetaData->Type, ParsedJsonString, ParsedJsonObj, MetaData);
-		}
-		
-		return;
-	}
+	// Only the type and id header lines are read for the dispatch, the body is sliced and decoded
+	// when a delegate or a cached message id response is waiting for it
+	const FAccelByteLobbyFrame Frame(Message);
 
-	const FString JsonTypeIdentifier = TEXT("type");
-	if (!ParsedJsonObj->HasTypedField<EJson::String>(JsonTypeIdentifier))
+	FStringView TypeValue;
+	if (!Frame.TryGetField(TEXT("type"), TypeValue) || TypeValue.Len() == 0)
 	{
 		return;
 	}
 
-	const FString ReceivedMessageType = ParsedJsonObj->GetStringField(JsonTypeIdentifier);
+	const FString ReceivedMessageType = FAccelByteLobbyFrameDecoder::UnquoteValue(TypeValue);
 	UE_LOG(LogAccelByteLobby, Display, TEXT("Type: %s"), *ReceivedMessageType);
 
 	if (ReceivedMessageType.Equals(LobbyResponse::SessionNotif))
 	{
-		HandleV2SessionNotif(ParsedJsonString);
+		HandleV2SessionNotif(Frame);
 	}
 	else if (ReceivedMessageType.Contains(Suffix::Response))
 	{
-		HandleMessageResponse(ReceivedMessageType, ParsedJsonString, ParsedJsonObj);
+		HandleMessageResponse(ReceivedMessageType, Frame);
 	}
 	else if (ReceivedMessageType.Contains(Suffix::Notif))
 	{
-		HandleMessageNotif(ReceivedMessageType, ParsedJsonString, ParsedJsonObj);
+		HandleMessageNotif(ReceivedMessageType, Frame);
 	}
 	else // undefined; not Response nor Notif
 	{
-		ParsingError.ExecuteIfBound(-1, FString::Printf(TEXT("Error cannot parse message. Neither a response nor a notif type. %s, Raw: %s"), *ReceivedMessageType, *ParsedJsonString));
+		ParsingError.ExecuteIfBound(-1, FString::Printf(TEXT("Error cannot parse message. Neither a response nor a notif type. %s, Raw: %s"), *ReceivedMessageType, *Message));
 	}
 
 }
@@ -13,6 +13,13 @@ MatchmakingV2::MatchmakingV2(Credentials const& InCredentialsRef
 	, FHttpRetryScheduler& InHttpRef)
 	: FApiBase(InCredentialsRef, InSettingRef, InHttpRef)
 {
+	HttpClient.SetDefaultRequestPriority(EAccelByteHttpRequestPriority::Critical);
+
+	// The player is waiting in the matchmaking flow, give up early rather than retrying for a minute
+	FHttpRequestPolicy Policy;
+	Policy.Deadline = 15.0;
+	Policy.MaximumDelay = 5.0;
+	HttpClient.SetDefaultRequestPolicy(Policy);
 }
 
 MatchmakingV2::~MatchmakingV2()
@@ -41,7 +41,11 @@ void Order::CreateNewOrder(const FAccelByteModelsOrderCreate& OrderCreate
 	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Content);
 	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
 
-	HttpClient.ApiRequest(TEXT("POST"), Url, {}, Content, OnSuccess, OnError);
+	// Don't place the order twice when the first attempt might have reached the server
+	FHttpRequestPolicy Policy;
+	Policy.bIsIdempotent = false;
+
+	HttpClient.ApiRequest(Policy, TEXT("POST"), Url, FHttpFormData{}, Content, OnSuccess, OnError);
 }
 
 void Order::CancelOrder(const FString& OrderNo
@@ -0,0 +1,215 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Api/AccelBytePrefetchApi.h"
+#include "AccelByteUe4SdkModule.h"
+#include "Core/AccelByteCredentials.h"
+#include "Core/AccelByteReport.h"
+#include "Core/AccelByteSettings.h"
+
+namespace AccelByte
+{
+namespace Api
+{
+
+namespace
+{
+	const TCHAR* const PrefetchConfigSection = TEXT("AccelBytePrefetch");
+}
+
+Prefetch::Prefetch(Credentials& InCredentialsRef
+	, Settings const& InSettingsRef
+	, FHttpRetryScheduler& InHttpRef)
+	: FApiBase(InCredentialsRef, InSettingsRef, InHttpRef)
+	, CredentialsRef{InCredentialsRef}
+	, bValidityFlagPtr(MakeShared<bool>(true))
+{
+	HttpClient.SetDefaultRequestPriority(EAccelByteHttpRequestPriority::Background);
+	LoginSuccessHandle = CredentialsRef.OnLoginSuccess().AddRaw(this, &Prefetch::OnLoginSuccess);
+}
+
+Prefetch::~Prefetch()
+{
+	CredentialsRef.OnLoginSuccess().Remove(LoginSuccessHandle);
+	bValidityFlagPtr.Reset();
+}
+
+TArray<FAccelByteModelsPrefetchEntry> Prefetch::GetDefaultManifest()
+{
+	return {
+		{ TEXT("StoreDisplayViews"), TEXT("{platformServerUrl}/public/namespaces/{namespace}/users/{userId}/views") },
+		{ TEXT("Stores"), TEXT("{platformServerUrl}/public/namespaces/{namespace}/stores") },
+		{ TEXT("Entitlements"), TEXT("{platformServerUrl}/public/namespaces/{namespace}/users/{userId}/entitlements?limit=20") },
+		{ TEXT("MyStatItems"), TEXT("{statisticServerUrl}/v1/public/namespaces/{namespace}/users/me/statitems?limit=20&offset=0") },
+		{ TEXT("Achievements"), TEXT("{achievementServerUrl}/v1/public/namespaces/{namespace}/achievements?language=en-US&offset=0&limit=20&global=false") },
+		{ TEXT("LegalEligibilities"), TEXT("{agreementServerUrl}/public/eligibilities/namespaces/{namespace}") },
+	};
+}
+
+void Prefetch::SetManifest(TArray<FAccelByteModelsPrefetchEntry> const& InManifest)
+{
+	LoadConfig();
+	Manifest = InManifest;
+}
+
+TArray<FAccelByteModelsPrefetchEntry> const& Prefetch::GetManifest()
+{
+	LoadConfig();
+	return Manifest;
+}
+
+void Prefetch::SetPrefetchOnLogin(bool bEnabled)
+{
+	LoadConfig();
+	bPrefetchOnLogin = bEnabled;
+}
+
+void Prefetch::UnbindLoginSuccess()
+{
+	CredentialsRef.OnLoginSuccess().Remove(LoginSuccessHandle);
+	LoginSuccessHandle.Reset();
+}
+
+void Prefetch::LoadConfig()
+{
+	// Loaded on first use, the configuration is not available yet when the registry is constructed
+	if (bIsConfigLoaded)
+	{
+		return;
+	}
+	bIsConfigLoaded = true;
+
+	GConfig->GetBool(PrefetchConfigSection, TEXT("bPrefetchOnLogin"), bPrefetchOnLogin, GEngineIni);
+
+	TArray<FString> Entries;
+	GConfig->GetArray(PrefetchConfigSection, TEXT("Entries"), Entries, GEngineIni);
+	if (Entries.Num() == 0)
+	{
+		Manifest = GetDefaultManifest();
+		return;
+	}
+
+	for (const FString& Entry : Entries)
+	{
+		FString Name;
+		FString Url;
+		if (!Entry.Split(TEXT("="), &Name, &Url) || Name.TrimStartAndEnd().IsEmpty() || Url.TrimStartAndEnd().IsEmpty())
+		{
+			UE_LOG(LogAccelByte, Warning, TEXT("Invalid prefetch entry [%s], expected Name=Url"), *Entry);
+			continue;
+		}
+		Manifest.Add({ Name.TrimStartAndEnd(), Url.TrimStartAndEnd() });
+	}
+}
+
+void Prefetch::OnLoginSuccess(FOauth2Token const& Response)
+{
+	LoadConfig();
+	if (bPrefetchOnLogin)
+	{
+		Run();
+	}
+}
+
+FString Prefetch::FormatEntryUrl(FString const& Url) const
+{
+	// {namespace} and {userId} are replaced by the HTTP client
+	const FStringFormatNamedArguments UrlArgs = {
+		{ TEXT("namespace"), FStringFormatArg(TEXT("{namespace}")) },
+		{ TEXT("userId"), FStringFormatArg(TEXT("{userId}")) },
+		{ TEXT("publisherNamespace"), FStringFormatArg(SettingsRef.PublisherNamespace) },
+		{ TEXT("platformServerUrl"), FStringFormatArg(SettingsRef.PlatformServerUrl) },
+		{ TEXT("statisticServerUrl"), FStringFormatArg(SettingsRef.StatisticServerUrl) },
+		{ TEXT("achievementServerUrl"), FStringFormatArg(SettingsRef.AchievementServerUrl) },
+		{ TEXT("agreementServerUrl"), FStringFormatArg(SettingsRef.AgreementServerUrl) },
+		{ TEXT("cloudSaveServerUrl"), FStringFormatArg(SettingsRef.CloudSaveServerUrl) },
+		{ TEXT("basicServerUrl"), FStringFormatArg(SettingsRef.BasicServerUrl) },
+		{ TEXT("leaderboardServerUrl"), FStringFormatArg(SettingsRef.LeaderboardServerUrl) },
+	};
+
+	return FString::Format(*Url, UrlArgs);
+}
+
+bool Prefetch::Run()
+{
+	FReport::Log(FString(__FUNCTION__));
+
+	LoadConfig();
+	if (CredentialsRef.GetAccessToken().IsEmpty())
+	{
+		UE_LOG(LogAccelByte, Warning, TEXT("Cannot prefetch, the user is not logged in"));
+		return false;
+	}
+	if (CurrentRun.IsValid())
+	{
+		UE_LOG(LogAccelByte, Verbose, TEXT("Prefetch is already running"));
+		return false;
+	}
+	if (Manifest.Num() == 0)
+	{
+		return false;
+	}
+	if (!SettingsRef.bEnableHttpCache)
+	{
+		UE_LOG(LogAccelByte, Warning, TEXT("Prefetching with the HTTP cache disabled, the responses won't be kept"));
+	}
+
+	const TSharedRef<FRun> Run = MakeShared<FRun>();
+	Run->StartTime = FPlatformTime::Seconds();
+	Run->PendingNum = Manifest.Num();
+	Run->Event.Results.SetNum(Manifest.Num());
+	CurrentRun = Run;
+
+	// Every request is sent before any response is handled, they are all in flight together
+	const TWeakPtr<bool> ValidityFlag = bValidityFlagPtr;
+	for (int32 Index = 0; Index < Manifest.Num(); Index++)
+	{
+		Run->Event.Results[Index].Name = Manifest[Index].Name;
+
+		HttpClient.ApiRequest(TEXT("GET"), FormatEntryUrl(Manifest[Index].Url), {}, FString()
+			, FVoidHandler::CreateLambda([this, ValidityFlag, Run, Index]()
+			{
+				if (ValidityFlag.IsValid())
+				{
+					OnEntryFinished(Run, Index, true, 0);
+				}
+			})
+			, FErrorHandler::CreateLambda([this, ValidityFlag, Run, Index](int32 ErrorCode, FString const& ErrorMessage)
+			{
+				if (ValidityFlag.IsValid())
+				{
+					OnEntryFinished(Run, Index, false, ErrorCode);
+				}
+			}));
+	}
+
+	return true;
+}
+
+void Prefetch::OnEntryFinished(TSharedRef<FRun> const& Run, int32 Index, bool bSucceeded, int32 ErrorCode)
+{
+	FAccelByteModelsPrefetchEntryResult& Result = Run->Event.Results[Index];
+	Result.bSucceeded = bSucceeded;
+	Result.ErrorCode = ErrorCode;
+	Result.ElapsedSeconds = FPlatformTime::Seconds() - Run->StartTime;
+	Run->Event.SucceededNum += bSucceeded ? 1 : 0;
+
+	if (--Run->PendingNum > 0)
+	{
+		return;
+	}
+
+	Run->Event.ElapsedSeconds = FPlatformTime::Seconds() - Run->StartTime;
+	if (CurrentRun == Run)
+	{
+		CurrentRun.Reset();
+	}
+
+	UE_LOG(LogAccelByte, Verbose, TEXT("Prefetch finished in %.3f seconds, %d of %d succeeded")
+		, Run->Event.ElapsedSeconds, Run->Event.SucceededNum, Run->Event.Results.Num());
+	WarmDelegate.Broadcast(Run->Event);
+}
+
+} // Namespace Api
+} // Namespace AccelByte
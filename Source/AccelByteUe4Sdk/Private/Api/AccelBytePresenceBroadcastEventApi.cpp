@@ -16,6 +16,7 @@ PresenceBroadcastEvent::PresenceBroadcastEvent(Credentials& InCredentialsRef
 	: FApiBase(InCredentialsRef, InSettingsRef, InHttpRef)
 	, CredentialsRef{ InCredentialsRef }
 {
+	HttpClient.SetDefaultRequestPriority(EAccelByteHttpRequestPriority::Background);
 	CredentialsRef.OnLoginSuccess().AddRaw(this, &PresenceBroadcastEvent::OnLoginSuccess);
 }
 
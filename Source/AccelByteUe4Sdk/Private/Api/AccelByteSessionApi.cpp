@@ -51,7 +51,9 @@ Session::Session(Credentials const& InCredentialsRef
 	, Settings const& InSettingsRef
 	, FHttpRetryScheduler& InHttpRef)
 	: FApiBase(InCredentialsRef, InSettingsRef, InHttpRef)
-{}
+{
+	HttpClient.SetDefaultRequestPriority(EAccelByteHttpRequestPriority::Critical);
+}
 
 Session::~Session()
 {}
@@ -0,0 +1,288 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Api/AccelByteUserResolverApi.h"
+#include "AccelByteUe4SdkModule.h"
+#include "Core/AccelByteCredentials.h"
+#include "Core/AccelByteReport.h"
+#include "Core/AccelByteSettings.h"
+#include "JsonObjectConverter.h"
+
+namespace AccelByte
+{
+namespace Api
+{
+
+namespace
+{
+	// The cache is emptied when the new users would go over it
+	constexpr int32 MaxCachedUserNum = 1024;
+}
+
+UserResolver::UserResolver(Credentials& InCredentialsRef
+	, Settings const& InSettingsRef
+	, FHttpRetryScheduler& InHttpRef)
+	: FApiBase(InCredentialsRef, InSettingsRef, InHttpRef)
+	, CredentialsRef{InCredentialsRef}
+	, bValidityFlagPtr(MakeShared<bool>(true))
+{
+	LoginSuccessHandle = CredentialsRef.OnLoginSuccess().AddRaw(this, &UserResolver::OnLoginSuccess);
+}
+
+UserResolver::~UserResolver()
+{
+	CredentialsRef.OnLoginSuccess().Remove(LoginSuccessHandle);
+	if (UObjectInitialized() && FlushTickDelegateHandle.IsValid())
+	{
+		FTickerAlias::GetCoreTicker().RemoveTicker(FlushTickDelegateHandle);
+		FlushTickDelegateHandle.Reset();
+	}
+	bValidityFlagPtr.Reset();
+}
+
+void UserResolver::SetBatchWindow(FTimespan Window)
+{
+	BatchWindow = Window < FTimespan::Zero() ? FTimespan::Zero() : Window;
+}
+
+void UserResolver::SetMaxBatchSize(int32 InMaxBatchSize)
+{
+	MaxBatchSize = FMath::Max(InMaxBatchSize, 1);
+}
+
+void UserResolver::SetCacheTtl(FTimespan Ttl)
+{
+	CacheTtl = Ttl;
+	if (CacheTtl <= FTimespan::Zero())
+	{
+		CachedUsers.Empty();
+	}
+}
+
+void UserResolver::ClearCache()
+{
+	CachedUsers.Empty();
+}
+
+void UserResolver::GetUserInfo(FString const& UserId
+	, THandler<FBaseUserInfo> const& OnSuccess
+	, FErrorHandler const& OnError)
+{
+	if (UserId.IsEmpty())
+	{
+		OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidRequest), TEXT("UserId cannot be empty!"));
+		return;
+	}
+
+	if (const FCachedUser* CachedUser = CachedUsers.Find(UserId))
+	{
+		if (CachedUser->ExpireTime >= FPlatformTime::Seconds())
+		{
+			OnSuccess.ExecuteIfBound(CachedUser->Info);
+			return;
+		}
+		CachedUsers.Remove(UserId);
+	}
+
+	// An ID already pending or in flight only gets another waiter
+	TArray<FWaiter>& UserWaiters = Waiters.FindOrAdd(UserId);
+	UserWaiters.Add(FWaiter{ OnSuccess, OnError });
+	if (UserWaiters.Num() > 1)
+	{
+		return;
+	}
+	PendingIds.Add(UserId);
+
+	if (!FlushTickDelegateHandle.IsValid())
+	{
+		FlushTickDelegateHandle = FTickerAlias::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(this, &UserResolver::FlushPendingIds),
+			static_cast<float>(BatchWindow.GetTotalSeconds()));
+	}
+}
+
+void UserResolver::GetUserInfos(TArray<FString> const& UserIds
+	, THandler<FListBulkUserInfo> const& OnSuccess
+	, FErrorHandler const& OnError)
+{
+	TArray<FString> UniqueUserIds;
+	for (const FString& UserId : UserIds)
+	{
+		if (!UserId.IsEmpty())
+		{
+			UniqueUserIds.AddUnique(UserId);
+		}
+	}
+
+	if (UniqueUserIds.Num() == 0)
+	{
+		OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidRequest), TEXT("UserIds cannot be empty!"));
+		return;
+	}
+
+	struct FAggregate
+	{
+		int32 PendingNum{0};
+		int32 ErrorCode{0};
+		FString ErrorMessage;
+		FListBulkUserInfo Result;
+	};
+	const TSharedRef<FAggregate> Aggregate = MakeShared<FAggregate>();
+	Aggregate->PendingNum = UniqueUserIds.Num();
+
+	auto OnResolved = [Aggregate, OnSuccess, OnError]()
+	{
+		if (--Aggregate->PendingNum > 0)
+		{
+			return;
+		}
+
+		if (Aggregate->ErrorCode != 0)
+		{
+			OnError.ExecuteIfBound(Aggregate->ErrorCode, Aggregate->ErrorMessage);
+		}
+		else
+		{
+			OnSuccess.ExecuteIfBound(Aggregate->Result);
+		}
+	};
+
+	for (const FString& UserId : UniqueUserIds)
+	{
+		GetUserInfo(UserId
+			, THandler<FBaseUserInfo>::CreateLambda([Aggregate, OnResolved](FBaseUserInfo const& Info)
+			{
+				Aggregate->Result.Data.Add(Info);
+				OnResolved();
+			})
+			, FErrorHandler::CreateLambda([Aggregate, OnResolved](int32 ErrorCode, FString const& ErrorMessage)
+			{
+				// A missing user is left out like the bulk endpoint does
+				if (ErrorCode != static_cast<int32>(ErrorCodes::StatusNotFound))
+				{
+					Aggregate->ErrorCode = ErrorCode;
+					Aggregate->ErrorMessage = ErrorMessage;
+				}
+				OnResolved();
+			}));
+	}
+}
+
+bool UserResolver::FlushPendingIds(float DeltaTime)
+{
+	FlushTickDelegateHandle.Reset();
+
+	TArray<FString> UserIds = MoveTemp(PendingIds);
+	PendingIds.Reset();
+
+	for (int32 Offset = 0; Offset < UserIds.Num(); Offset += MaxBatchSize)
+	{
+		const int32 Count = FMath::Min(MaxBatchSize, UserIds.Num() - Offset);
+		SendBatch(TArray<FString>(UserIds.GetData() + Offset, Count));
+	}
+
+	// Only ticks once, the next request schedules the next flush
+	return false;
+}
+
+void UserResolver::SendBatch(TArray<FString> const& UserIds)
+{
+	FReport::Log(FString(__FUNCTION__));
+
+	const FListBulkUserInfoRequest UserList{ UserIds };
+
+	const FString Url = FString::Printf(TEXT("%s/v3/public/namespaces/%s/users/bulk/basic")
+		, *SettingsRef.IamServerUrl
+		, *SettingsRef.Namespace);
+
+	FString Content;
+	FJsonObjectConverter::UStructToJsonObjectString(UserList, Content);
+
+	TMap<FString, FString> Headers = {
+		{TEXT("Content-Type"), TEXT("application/json")},
+		{TEXT("Accept"), TEXT("application/json")}
+	};
+
+	const TWeakPtr<bool> ValidityFlag = bValidityFlagPtr;
+	HttpClient.Request(TEXT("POST"), Url, Content, Headers
+		, THandler<FListBulkUserInfo>::CreateLambda([this, ValidityFlag, UserIds](FListBulkUserInfo const& Result)
+		{
+			if (ValidityFlag.IsValid())
+			{
+				OnBatchSucceeded(UserIds, Result);
+			}
+		})
+		, FErrorHandler::CreateLambda([this, ValidityFlag, UserIds](int32 ErrorCode, FString const& ErrorMessage)
+		{
+			if (ValidityFlag.IsValid())
+			{
+				OnBatchFailed(UserIds, ErrorCode, ErrorMessage);
+			}
+		}));
+}
+
+void UserResolver::OnBatchSucceeded(TArray<FString> const& UserIds, FListBulkUserInfo const& Result)
+{
+	const bool bIsCacheEnabled = CacheTtl > FTimespan::Zero();
+	const double ExpireTime = FPlatformTime::Seconds() + CacheTtl.GetTotalSeconds();
+	if (bIsCacheEnabled && CachedUsers.Num() + Result.Data.Num() > MaxCachedUserNum)
+	{
+		CachedUsers.Empty();
+	}
+
+	TMap<FString, const FBaseUserInfo*> ResolvedUsers;
+	for (const FBaseUserInfo& Info : Result.Data)
+	{
+		ResolvedUsers.Add(Info.UserId, &Info);
+		if (bIsCacheEnabled)
+		{
+			CachedUsers.Add(Info.UserId, FCachedUser{ Info, ExpireTime });
+		}
+	}
+
+	// The waiters are taken out first, a handler might request the same user again
+	for (const FString& UserId : UserIds)
+	{
+		TArray<FWaiter> UserWaiters;
+		Waiters.RemoveAndCopyValue(UserId, UserWaiters);
+
+		const FBaseUserInfo* const* Info = ResolvedUsers.Find(UserId);
+		for (const FWaiter& Waiter : UserWaiters)
+		{
+			if (Info != nullptr)
+			{
+				Waiter.OnSuccess.ExecuteIfBound(**Info);
+			}
+			else
+			{
+				Waiter.OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::StatusNotFound), FString::Printf(TEXT("User %s is not found"), *UserId));
+			}
+		}
+	}
+}
+
+void UserResolver::OnBatchFailed(TArray<FString> const& UserIds, int32 ErrorCode, FString const& ErrorMessage)
+{
+	UE_LOG(LogAccelByte, Warning, TEXT("Resolving %d users failed: %d %s"), UserIds.Num(), ErrorCode, *ErrorMessage);
+
+	for (const FString& UserId : UserIds)
+	{
+		TArray<FWaiter> UserWaiters;
+		Waiters.RemoveAndCopyValue(UserId, UserWaiters);
+
+		for (const FWaiter& Waiter : UserWaiters)
+		{
+			Waiter.OnError.ExecuteIfBound(ErrorCode, ErrorMessage);
+		}
+	}
+}
+
+void UserResolver::OnLoginSuccess(FOauth2Token const& Response)
+{
+	// The namespace might have changed with the user
+	ClearCache();
+}
+
+} // Namespace Api
+} // Namespace AccelByte
@@ -27,6 +27,9 @@ FApiClient::FApiClient(AccelByte::Credentials& Credentials, AccelByte::FHttpRetr
 {
 	GameTelemetry.Startup();
 	PresenceBroadcastEvent.Startup();
+
+	// The owner of the shared credentials, e.g. FRegistry, already prefetches on their login
+	Prefetch.UnbindLoginSuccess();
 }
 
 FApiClient::~FApiClient()
@@ -0,0 +1,769 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteCacheSegmentStore.h"
+#include "Async/Async.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteCacheStore, Log, All);
+DEFINE_LOG_CATEGORY(LogAccelByteCacheStore);
+
+namespace AccelByte
+{
+namespace Core
+{
+
+int64 FAccelByteCacheSegmentStore::FIndexEntry::GetRecordSize() const
+{
+	return RecordHeaderSize + KeySize + ValueSize;
+}
+
+int64 FAccelByteCacheSegmentStore::FIndexEntry::GetValueOffset() const
+{
+	return Offset + RecordHeaderSize + KeySize;
+}
+
+FAccelByteCacheSegmentStore::FAccelByteCacheSegmentStore(const FString& InDirectory, const FString& InName)
+	: SegmentPath(FPaths::Combine(InDirectory, InName + TEXT(".seg")))
+	, IndexPath(FPaths::Combine(InDirectory, InName + TEXT(".idx")))
+{
+}
+
+FAccelByteCacheSegmentStore::~FAccelByteCacheSegmentStore()
+{
+	Close();
+}
+
+bool FAccelByteCacheSegmentStore::Open(TArray<FRecoveredEntry>& OutEntries)
+{
+	Close();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(SegmentPath));
+
+	Index.Reset();
+	LiveBytes = 0;
+	FlushedSize = 0;
+
+	bool bIsSegmentValid = false;
+	bool bIsTornTail = false;
+	if (PlatformFile.FileExists(*SegmentPath))
+	{
+		IFileHandle* Handle = PlatformFile.OpenRead(*SegmentPath, true);
+		if (Handle != nullptr)
+		{
+			SegmentSize = Handle->Size();
+			bIsSegmentValid = ReadSegmentHeader(*Handle, Generation);
+			if (bIsSegmentValid)
+			{
+				const int64 ScanFrom = LoadIndex() ? FlushedSize : SegmentHeaderSize;
+				ScanSegment(*Handle, ScanFrom, bIsTornTail);
+			}
+			delete Handle;
+		}
+	}
+
+	if (bIsSegmentValid)
+	{
+		Writer = PlatformFile.OpenWrite(*SegmentPath, true, true);
+
+		// Appending after a torn record would hide every later record, start from a clean segment instead
+		if (Writer != nullptr && bIsTornTail)
+		{
+			UE_LOG(LogAccelByteCacheStore, Warning, TEXT("Dropping the corrupted tail of the cache segment %s"), *SegmentPath);
+			Compact();
+		}
+	}
+	else
+	{
+		Index.Reset();
+		LiveBytes = 0;
+		Generation = FGuid::NewGuid();
+		SegmentSize = SegmentHeaderSize;
+		CreateSegment(SegmentPath, Generation, Writer);
+	}
+
+	if (Writer == nullptr)
+	{
+		UE_LOG(LogAccelByteCacheStore, Warning, TEXT("Unable to open the cache segment %s"), *SegmentPath);
+		Index.Reset();
+		LiveBytes = 0;
+		return false;
+	}
+	WriterFlushedSize = SegmentSize;
+	LastWriterFlushTime = FPlatformTime::Seconds();
+
+	TArray<TPair<FString, FIndexEntry>> Entries = Index.Array();
+	Entries.Sort([](const TPair<FString, FIndexEntry>& A, const TPair<FString, FIndexEntry>& B) { return A.Value.Offset < B.Value.Offset; });
+
+	OutEntries.Reset(Entries.Num());
+	for (const TPair<FString, FIndexEntry>& Entry : Entries)
+	{
+		OutEntries.Add(FRecoveredEntry{ Entry.Key, Entry.Value.ValueSize });
+	}
+
+	UE_LOG(LogAccelByteCacheStore, Verbose, TEXT("Recovered %d cached entries from %s"), OutEntries.Num(), *SegmentPath);
+	return true;
+}
+
+void FAccelByteCacheSegmentStore::Close()
+{
+	if (Writer == nullptr)
+	{
+		return;
+	}
+
+	// Waiting is cheaper than rewriting the whole segment again in the next session
+	if (CompactionTask.IsValid())
+	{
+		FinishCompaction(CompactionTask.Get());
+		CompactionTask.Reset();
+	}
+
+	Flush();
+	ReleaseReaders();
+	delete Writer;
+	Writer = nullptr;
+}
+
+bool FAccelByteCacheSegmentStore::Flush()
+{
+	if (Writer == nullptr)
+	{
+		return false;
+	}
+	FlushWriter();
+
+	TArray<uint8> Bytes;
+	FMemoryWriter IndexWriter(Bytes);
+
+	uint32 Magic = IndexMagic;
+	uint32 IndexVersion = Version;
+	int32 EntryNum = Index.Num();
+	int64 IndexedSize = SegmentSize;
+	IndexWriter << Magic << IndexVersion << Generation << IndexedSize << EntryNum;
+	for (TPair<FString, FIndexEntry>& Entry : Index)
+	{
+		IndexWriter << Entry.Key << Entry.Value.Offset << Entry.Value.KeySize << Entry.Value.ValueSize;
+	}
+	uint32 Crc = FCrc::MemCrc32(Bytes.GetData(), Bytes.Num());
+	IndexWriter << Crc;
+
+	// Replace the previous index in one move so a crash never leaves a half written index
+	const FString TempPath = IndexPath + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath) || !IFileManager::Get().Move(*IndexPath, *TempPath, true, true))
+	{
+		UE_LOG(LogAccelByteCacheStore, Warning, TEXT("Unable to write the cache index %s"), *IndexPath);
+		return false;
+	}
+
+	FlushedSize = SegmentSize;
+	return true;
+}
+
+bool FAccelByteCacheSegmentStore::Put(const FString& Key, const TArray<uint8>& Value)
+{
+	if (Writer == nullptr || Value.Num() > MaxValueSize)
+	{
+		return false;
+	}
+
+	const FTCHARToUTF8 KeyUtf8(*Key);
+	if (KeyUtf8.Length() == 0 || KeyUtf8.Length() > MaxKeySize)
+	{
+		return false;
+	}
+
+	FIndexEntry Entry;
+	if (!AppendRecord(*Writer, SegmentSize, ERecordType::Put, KeyUtf8, Value.GetData(), Value.Num(), &Entry))
+	{
+		// The record might be partially written, rewrite the segment from the index
+		Compact();
+		return false;
+	}
+	FlushWriterIfNeeded();
+
+	if (const FIndexEntry* Existing = Index.Find(Key))
+	{
+		LiveBytes -= Existing->GetRecordSize();
+	}
+	Index.Add(Key, Entry);
+	LiveBytes += Entry.GetRecordSize();
+
+	CompactIfNeeded();
+	return true;
+}
+
+bool FAccelByteCacheSegmentStore::Get(const FString& Key, TArray<uint8>& OutValue)
+{
+	const FIndexEntry* Entry = Index.Find(Key);
+	if (Entry == nullptr)
+	{
+		return false;
+	}
+	return ReadValue(*Entry, OutValue);
+}
+
+bool FAccelByteCacheSegmentStore::Remove(const FString& Key)
+{
+	FIndexEntry Entry;
+	if (Writer == nullptr || !Index.RemoveAndCopyValue(Key, Entry))
+	{
+		return false;
+	}
+	LiveBytes -= Entry.GetRecordSize();
+
+	// Without the removal record, the entry would be recovered again in the next session
+	const FTCHARToUTF8 KeyUtf8(*Key);
+	if (!AppendRecord(*Writer, SegmentSize, ERecordType::Remove, KeyUtf8, nullptr, 0, nullptr))
+	{
+		Compact();
+		return true;
+	}
+	FlushWriterIfNeeded();
+
+	CompactIfNeeded();
+	return true;
+}
+
+void FAccelByteCacheSegmentStore::Clear()
+{
+	AbandonCompaction();
+	ReleaseReaders();
+	if (Writer != nullptr)
+	{
+		delete Writer;
+		Writer = nullptr;
+	}
+
+	IFileManager::Get().Delete(*SegmentPath, false, true, true);
+	IFileManager::Get().Delete(*IndexPath, false, true, true);
+
+	Index.Reset();
+	LiveBytes = 0;
+	FlushedSize = 0;
+	Generation = FGuid::NewGuid();
+	SegmentSize = SegmentHeaderSize;
+	WriterFlushedSize = SegmentSize;
+	CreateSegment(SegmentPath, Generation, Writer);
+}
+
+bool FAccelByteCacheSegmentStore::Compact()
+{
+	if (Writer == nullptr)
+	{
+		return false;
+	}
+
+	// The snapshot of a background compaction might include a partially written record
+	AbandonCompaction();
+
+	const FString TempPath = SegmentPath + TEXT(".tmp");
+	const FGuid NewGeneration = FGuid::NewGuid();
+	IFileHandle* TempWriter = nullptr;
+	if (!CreateSegment(TempPath, NewGeneration, TempWriter))
+	{
+		return false;
+	}
+
+	// Keep the write order, it is the recovered order of the next session
+	TArray<TPair<FString, FIndexEntry>> Entries = Index.Array();
+	Entries.Sort([](const TPair<FString, FIndexEntry>& A, const TPair<FString, FIndexEntry>& B) { return A.Value.Offset < B.Value.Offset; });
+
+	TMap<FString, FIndexEntry> NewIndex;
+	NewIndex.Reserve(Entries.Num());
+	int64 NewSize = SegmentHeaderSize;
+	int64 NewLiveBytes = 0;
+	TArray<uint8> Value;
+	for (const TPair<FString, FIndexEntry>& Entry : Entries)
+	{
+		if (!ReadValue(Entry.Value, Value))
+		{
+			continue;
+		}
+
+		FIndexEntry NewEntry;
+		if (!AppendRecord(*TempWriter, NewSize, ERecordType::Put, FTCHARToUTF8(*Entry.Key), Value.GetData(), Value.Num(), &NewEntry))
+		{
+			delete TempWriter;
+			IFileManager::Get().Delete(*TempPath, false, true, true);
+			return false;
+		}
+		NewIndex.Add(Entry.Key, NewEntry);
+		NewLiveBytes += NewEntry.GetRecordSize();
+	}
+	TempWriter->Flush();
+	delete TempWriter;
+
+	return ReplaceSegment(TempPath, NewGeneration, MoveTemp(NewIndex), NewSize, NewLiveBytes);
+}
+
+bool FAccelByteCacheSegmentStore::ReplaceSegment(const FString& TempPath, const FGuid& NewGeneration, TMap<FString, FIndexEntry>&& NewIndex, int64 NewSize, int64 NewLiveBytes)
+{
+	ReleaseReaders();
+	delete Writer;
+	Writer = nullptr;
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!IFileManager::Get().Move(*SegmentPath, *TempPath, true, true))
+	{
+		UE_LOG(LogAccelByteCacheStore, Warning, TEXT("Unable to replace the cache segment %s"), *SegmentPath);
+		IFileManager::Get().Delete(*TempPath, false, true, true);
+		Writer = PlatformFile.OpenWrite(*SegmentPath, true, true);
+		return false;
+	}
+
+	Writer = PlatformFile.OpenWrite(*SegmentPath, true, true);
+	Generation = NewGeneration;
+	Index = MoveTemp(NewIndex);
+	SegmentSize = NewSize;
+	LiveBytes = NewLiveBytes;
+	FlushedSize = 0;
+	WriterFlushedSize = NewSize;
+
+	// The previous index belongs to the previous generation, it is ignored until this one is written
+	Flush();
+
+	return Writer != nullptr;
+}
+
+void FAccelByteCacheSegmentStore::StartCompaction()
+{
+	// The background thread reads the snapshot through its own handle, it has to be on the file already
+	FlushWriter();
+
+	TArray<TPair<FString, FIndexEntry>> Entries = Index.Array();
+	Entries.Sort([](const TPair<FString, FIndexEntry>& A, const TPair<FString, FIndexEntry>& B) { return A.Value.Offset < B.Value.Offset; });
+
+	// Only copies are handed to the background thread, the store keeps writing to the current segment meanwhile
+	CompactionTask = Async(EAsyncExecution::ThreadPool,
+		[SourcePath = SegmentPath, TempPath = SegmentPath + TEXT(".tmp"), Entries = MoveTemp(Entries), SnapshotSize = SegmentSize]()
+		{
+			FCompaction Compaction;
+			Compaction.Generation = FGuid::NewGuid();
+			Compaction.SnapshotSize = SnapshotSize;
+			WriteCompactedSegment(SourcePath, TempPath, Entries, Compaction);
+			return Compaction;
+		});
+}
+
+void FAccelByteCacheSegmentStore::WriteCompactedSegment(const FString& SourcePath, const FString& TempPath, const TArray<TPair<FString, FIndexEntry>>& Entries, FCompaction& OutCompaction)
+{
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	IFileHandle* Source = PlatformFile.OpenRead(*SourcePath, true);
+	IFileHandle* TempWriter = nullptr;
+	if (Source == nullptr || !CreateSegment(TempPath, OutCompaction.Generation, TempWriter))
+	{
+		delete Source;
+		return;
+	}
+
+	OutCompaction.Index.Reserve(Entries.Num());
+	OutCompaction.Size = SegmentHeaderSize;
+	OutCompaction.bIsSucceeded = true;
+
+	TArray<uint8> Value;
+	for (const TPair<FString, FIndexEntry>& Entry : Entries)
+	{
+		Value.SetNumUninitialized(Entry.Value.ValueSize, false);
+		if (Entry.Value.ValueSize > 0 && (!Source->Seek(Entry.Value.GetValueOffset()) || !Source->Read(Value.GetData(), Entry.Value.ValueSize)))
+		{
+			continue;
+		}
+
+		FIndexEntry NewEntry;
+		if (!AppendRecord(*TempWriter, OutCompaction.Size, ERecordType::Put, FTCHARToUTF8(*Entry.Key), Value.GetData(), Value.Num(), &NewEntry))
+		{
+			OutCompaction.bIsSucceeded = false;
+			break;
+		}
+		OutCompaction.Index.Add(Entry.Key, NewEntry);
+	}
+	TempWriter->Flush();
+	delete TempWriter;
+	delete Source;
+}
+
+bool FAccelByteCacheSegmentStore::FinishCompaction(const FCompaction& Compaction)
+{
+	const FString TempPath = SegmentPath + TEXT(".tmp");
+	if (!Compaction.bIsSucceeded || Writer == nullptr)
+	{
+		IFileManager::Get().Delete(*TempPath, false, true, true);
+		return false;
+	}
+
+	// Carry over the records appended since the snapshot as they are, the removals included
+	FlushWriter();
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	IFileHandle* Source = PlatformFile.OpenRead(*SegmentPath, true);
+	IFileHandle* TempWriter = PlatformFile.OpenWrite(*TempPath, true, true);
+	bool bIsCarriedOver = Source != nullptr && TempWriter != nullptr && Source->Seek(Compaction.SnapshotSize);
+
+	TArray<uint8> Bytes;
+	for (int64 Position = Compaction.SnapshotSize; bIsCarriedOver && Position < SegmentSize; Position += Bytes.Num())
+	{
+		Bytes.SetNumUninitialized(static_cast<int32>(FMath::Min(SegmentSize - Position, static_cast<int64>(CarryOverChunkSize))), false);
+		bIsCarriedOver = Source->Read(Bytes.GetData(), Bytes.Num()) && TempWriter->Write(Bytes.GetData(), Bytes.Num());
+	}
+	if (TempWriter != nullptr)
+	{
+		TempWriter->Flush();
+		delete TempWriter;
+	}
+	delete Source;
+
+	if (!bIsCarriedOver)
+	{
+		UE_LOG(LogAccelByteCacheStore, Warning, TEXT("Unable to carry over the latest records to the compacted segment %s"), *SegmentPath);
+		IFileManager::Get().Delete(*TempPath, false, true, true);
+		return false;
+	}
+
+	const int64 CarriedOverSize = SegmentSize - Compaction.SnapshotSize;
+	const int64 Shift = Compaction.Size - Compaction.SnapshotSize;
+
+	TMap<FString, FIndexEntry> NewIndex;
+	NewIndex.Reserve(Index.Num());
+	int64 NewLiveBytes = 0;
+	for (const TPair<FString, FIndexEntry>& Entry : Index)
+	{
+		FIndexEntry NewEntry;
+		if (Entry.Value.Offset >= Compaction.SnapshotSize)
+		{
+			NewEntry = Entry.Value;
+			NewEntry.Offset += Shift;
+		}
+		else if (const FIndexEntry* CompactedEntry = Compaction.Index.Find(Entry.Key))
+		{
+			NewEntry = *CompactedEntry;
+		}
+		else
+		{
+			continue;
+		}
+		NewIndex.Add(Entry.Key, NewEntry);
+		NewLiveBytes += NewEntry.GetRecordSize();
+	}
+
+	return ReplaceSegment(TempPath, Compaction.Generation, MoveTemp(NewIndex), Compaction.Size + CarriedOverSize, NewLiveBytes);
+}
+
+void FAccelByteCacheSegmentStore::AbandonCompaction()
+{
+	if (!CompactionTask.IsValid())
+	{
+		return;
+	}
+
+	CompactionTask.Wait();
+	CompactionTask.Reset();
+	IFileManager::Get().Delete(*(SegmentPath + TEXT(".tmp")), false, true, true);
+}
+
+void FAccelByteCacheSegmentStore::FlushWriter()
+{
+	if (Writer == nullptr)
+	{
+		return;
+	}
+	Writer->Flush();
+	WriterFlushedSize = SegmentSize;
+	LastWriterFlushTime = FPlatformTime::Seconds();
+}
+
+void FAccelByteCacheSegmentStore::FlushWriterIfNeeded()
+{
+	// A crash loses at most the latest batch, the torn tail is dropped on the next startup
+	if (WriterFlushedSize < SegmentSize && FPlatformTime::Seconds() - LastWriterFlushTime >= WriterFlushInterval)
+	{
+		FlushWriter();
+	}
+}
+
+bool FAccelByteCacheSegmentStore::CreateSegment(const FString& Path, const FGuid& InGeneration, IFileHandle*& OutHandle)
+{
+	OutHandle = FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*Path, false, true);
+	if (OutHandle == nullptr)
+	{
+		return false;
+	}
+
+	TArray<uint8> Bytes;
+	FMemoryWriter HeaderWriter(Bytes);
+	uint32 Magic = SegmentMagic;
+	uint32 SegmentVersion = Version;
+	FGuid SegmentGeneration = InGeneration;
+	HeaderWriter << Magic << SegmentVersion << SegmentGeneration;
+
+	if (!OutHandle->Write(Bytes.GetData(), Bytes.Num()))
+	{
+		delete OutHandle;
+		OutHandle = nullptr;
+		return false;
+	}
+	OutHandle->Flush();
+	return true;
+}
+
+bool FAccelByteCacheSegmentStore::ReadSegmentHeader(IFileHandle& Handle, FGuid& OutGeneration) const
+{
+	TArray<uint8> Bytes;
+	Bytes.SetNumUninitialized(SegmentHeaderSize);
+	if (Handle.Size() < SegmentHeaderSize || !Handle.Seek(0) || !Handle.Read(Bytes.GetData(), SegmentHeaderSize))
+	{
+		return false;
+	}
+
+	FMemoryReader HeaderReader(Bytes);
+	uint32 Magic = 0;
+	uint32 SegmentVersion = 0;
+	HeaderReader << Magic << SegmentVersion << OutGeneration;
+	return Magic == SegmentMagic && SegmentVersion == Version;
+}
+
+bool FAccelByteCacheSegmentStore::LoadIndex()
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *IndexPath, FILEREAD_Silent) || Bytes.Num() <= static_cast<int32>(sizeof(uint32)))
+	{
+		return false;
+	}
+
+	const int32 ContentSize = Bytes.Num() - sizeof(uint32);
+	uint32 StoredCrc = 0;
+	FMemory::Memcpy(&StoredCrc, Bytes.GetData() + ContentSize, sizeof(uint32));
+	if (StoredCrc != FCrc::MemCrc32(Bytes.GetData(), ContentSize))
+	{
+		return false;
+	}
+
+	FMemoryReader IndexReader(Bytes);
+	uint32 Magic = 0;
+	uint32 IndexVersion = 0;
+	FGuid IndexGeneration;
+	int64 IndexedSize = 0;
+	int32 EntryNum = 0;
+	IndexReader << Magic << IndexVersion << IndexGeneration << IndexedSize << EntryNum;
+
+	// An index of another generation describes a segment that has been rewritten since
+	if (IndexReader.IsError() || Magic != IndexMagic || IndexVersion != Version || IndexGeneration != Generation
+		|| IndexedSize < SegmentHeaderSize || IndexedSize > SegmentSize || EntryNum < 0)
+	{
+		return false;
+	}
+
+	TMap<FString, FIndexEntry> LoadedIndex;
+	LoadedIndex.Reserve(EntryNum);
+	int64 LoadedLiveBytes = 0;
+	for (int32 i = 0; i < EntryNum; i++)
+	{
+		FString Key;
+		FIndexEntry Entry;
+		IndexReader << Key << Entry.Offset << Entry.KeySize << Entry.ValueSize;
+		if (IndexReader.IsError() || Entry.Offset < SegmentHeaderSize || Entry.Offset + Entry.GetRecordSize() > IndexedSize)
+		{
+			return false;
+		}
+		LoadedIndex.Add(Key, Entry);
+		LoadedLiveBytes += Entry.GetRecordSize();
+	}
+
+	Index = MoveTemp(LoadedIndex);
+	LiveBytes = LoadedLiveBytes;
+	FlushedSize = IndexedSize;
+	return true;
+}
+
+bool FAccelByteCacheSegmentStore::ScanSegment(IFileHandle& Handle, int64 From, bool& bOutIsTornTail)
+{
+	bOutIsTornTail = false;
+
+	TArray<uint8> Header;
+	Header.SetNumUninitialized(RecordHeaderSize);
+	TArray<uint8> Body;
+
+	int64 Position = From;
+	while (Position < SegmentSize)
+	{
+		if (Position + RecordHeaderSize > SegmentSize || !Handle.Seek(Position) || !Handle.Read(Header.GetData(), RecordHeaderSize))
+		{
+			bOutIsTornTail = true;
+			break;
+		}
+
+		FMemoryReader HeaderReader(Header);
+		uint32 Magic = 0;
+		uint8 Type = 0;
+		FIndexEntry Entry;
+		uint32 Crc = 0;
+		HeaderReader << Magic << Type << Entry.KeySize << Entry.ValueSize << Crc;
+		Entry.Offset = Position;
+
+		const bool bIsHeaderValid = Magic == RecordMagic
+			&& (Type == static_cast<uint8>(ERecordType::Put) || Type == static_cast<uint8>(ERecordType::Remove))
+			&& Entry.KeySize > 0 && Entry.KeySize <= MaxKeySize
+			&& Entry.ValueSize >= 0 && Entry.ValueSize <= MaxValueSize
+			&& Position + Entry.GetRecordSize() <= SegmentSize;
+		if (!bIsHeaderValid)
+		{
+			bOutIsTornTail = true;
+			break;
+		}
+
+		Body.SetNumUninitialized(Entry.KeySize + Entry.ValueSize, false);
+		if (!Handle.Read(Body.GetData(), Body.Num()) || FCrc::MemCrc32(Body.GetData(), Body.Num()) != Crc)
+		{
+			bOutIsTornTail = true;
+			break;
+		}
+
+		const FUTF8ToTCHAR KeyConverter(reinterpret_cast<const ANSICHAR*>(Body.GetData()), Entry.KeySize);
+		const FString Key(KeyConverter.Length(), KeyConverter.Get());
+
+		FIndexEntry Existing;
+		if (Index.RemoveAndCopyValue(Key, Existing))
+		{
+			LiveBytes -= Existing.GetRecordSize();
+		}
+		if (Type == static_cast<uint8>(ERecordType::Put))
+		{
+			Index.Add(Key, Entry);
+			LiveBytes += Entry.GetRecordSize();
+		}
+
+		Position += Entry.GetRecordSize();
+	}
+
+	return !bOutIsTornTail;
+}
+
+bool FAccelByteCacheSegmentStore::AppendRecord(IFileHandle& Handle, int64& InOutSize, ERecordType Type, const FTCHARToUTF8& Key, const uint8* Value, int32 ValueSize, FIndexEntry* OutEntry)
+{
+	const int32 KeySize = Key.Length();
+	uint32 Crc = FCrc::MemCrc32(Key.Get(), KeySize);
+	if (ValueSize > 0)
+	{
+		Crc = FCrc::MemCrc32(Value, ValueSize, Crc);
+	}
+
+	TArray<uint8> Bytes;
+	Bytes.Reserve(RecordHeaderSize + KeySize + ValueSize);
+	FMemoryWriter RecordWriter(Bytes);
+	uint32 Magic = RecordMagic;
+	uint8 RecordType = static_cast<uint8>(Type);
+	int32 RecordKeySize = KeySize;
+	int32 RecordValueSize = ValueSize;
+	RecordWriter << Magic << RecordType << RecordKeySize << RecordValueSize << Crc;
+	RecordWriter.Serialize(const_cast<ANSICHAR*>(Key.Get()), KeySize);
+	if (ValueSize > 0)
+	{
+		RecordWriter.Serialize(const_cast<uint8*>(Value), ValueSize);
+	}
+
+	if (!Handle.Write(Bytes.GetData(), Bytes.Num()))
+	{
+		return false;
+	}
+
+	if (OutEntry != nullptr)
+	{
+		OutEntry->Offset = InOutSize;
+		OutEntry->KeySize = KeySize;
+		OutEntry->ValueSize = ValueSize;
+	}
+	InOutSize += Bytes.Num();
+	return true;
+}
+
+bool FAccelByteCacheSegmentStore::ReadValue(const FIndexEntry& Entry, TArray<uint8>& OutValue)
+{
+	OutValue.SetNumUninitialized(Entry.ValueSize, false);
+	if (Entry.ValueSize == 0)
+	{
+		return true;
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	const int64 ValueOffset = Entry.GetValueOffset();
+
+	// The readers have their own handles, the latest batch might still be held by the writer
+	if (ValueOffset + Entry.ValueSize > WriterFlushedSize)
+	{
+		FlushWriter();
+	}
+
+	if (bIsMappingSupported)
+	{
+		// The mapping covers the segment size at the time it is opened, remap to reach the latest records
+		if (MappedSegment != nullptr && ValueOffset + Entry.ValueSize > MappedSegment->GetFileSize())
+		{
+			delete MappedSegment;
+			MappedSegment = nullptr;
+		}
+		if (MappedSegment == nullptr)
+		{
+			MappedSegment = PlatformFile.OpenMapped(*SegmentPath);
+			bIsMappingSupported = MappedSegment != nullptr;
+		}
+		if (MappedSegment != nullptr && ValueOffset + Entry.ValueSize <= MappedSegment->GetFileSize())
+		{
+			IMappedFileRegion* Region = MappedSegment->MapRegion(ValueOffset, Entry.ValueSize);
+			if (Region != nullptr)
+			{
+				FMemory::Memcpy(OutValue.GetData(), Region->GetMappedPtr(), Entry.ValueSize);
+				delete Region;
+				return true;
+			}
+		}
+	}
+
+	if (Reader == nullptr)
+	{
+		Reader = PlatformFile.OpenRead(*SegmentPath, true);
+	}
+	return Reader != nullptr && Reader->Seek(ValueOffset) && Reader->Read(OutValue.GetData(), Entry.ValueSize);
+}
+
+void FAccelByteCacheSegmentStore::ReleaseReaders()
+{
+	if (MappedSegment != nullptr)
+	{
+		delete MappedSegment;
+		MappedSegment = nullptr;
+	}
+	if (Reader != nullptr)
+	{
+		delete Reader;
+		Reader = nullptr;
+	}
+}
+
+void FAccelByteCacheSegmentStore::CompactIfNeeded()
+{
+	if (CompactionTask.IsValid())
+	{
+		if (CompactionTask.IsReady())
+		{
+			FinishCompaction(CompactionTask.Get());
+			CompactionTask.Reset();
+		}
+		return;
+	}
+
+	const int64 RecordBytes = SegmentSize - SegmentHeaderSize;
+	if (SegmentSize > CompactionMinSegmentSize && LiveBytes * 2 < RecordBytes)
+	{
+		StartCompaction();
+	}
+}
+
+}
+}
@@ -307,7 +307,11 @@ namespace AccelByte
 		{ static_cast<int32>(ErrorCodes::JsonDeserializationFailed), TEXT("JSON deserialization failed.") },
 		{ static_cast<int32>(ErrorCodes::NetworkError), TEXT("There is no response.") },
 		{ static_cast<int32>(ErrorCodes::IsNotLoggedIn), TEXT("User not logged in.") },
+		{ static_cast<int32>(ErrorCodes::CircuitBreakerOpen), TEXT("Request not sent, the service is temporarily unavailable.") },
 		{ static_cast<int32>(ErrorCodes::WebSocketConnectFailed), TEXT("WebSocket connect failed.") },
+		{ static_cast<int32>(ErrorCodes::WebSocketRequestTimeout), TEXT("WebSocket request timed out.") },
+		{ static_cast<int32>(ErrorCodes::WebSocketRequestNotSent), TEXT("WebSocket request was dropped before it was sent.") },
+		{ static_cast<int32>(ErrorCodes::WebSocketRequestSuperseded), TEXT("WebSocket request was replaced by a newer one before it was sent.") },
 		
 	};
 
@@ -568,6 +572,27 @@ namespace AccelByte
 		}
 	}
 
+	void HandleHttpRequestNotSent(FHttpRequestPtr Request, int& OutCode, FString& OutMessage)
+	{
+		OutCode = static_cast<int32>(ErrorCodes::NetworkError);
+		OutMessage = TEXT("Request not sent.");
+
+		if (!Request.IsValid())
+		{
+			return;
+		}
+
+		const FString Reason = Request->GetHeader(GHeaderABRequestNotSentReason);
+		if (!Reason.IsEmpty() && Reason.IsNumeric())
+		{
+			OutCode = FCString::Atoi(*Reason);
+			auto it = ErrorMessages::Default.find(OutCode);
+			if (it != ErrorMessages::Default.cend())
+			{
+				OutMessage = it->second;
+			}
+		}
+	}
 
 } // Namespace AccelByte
 
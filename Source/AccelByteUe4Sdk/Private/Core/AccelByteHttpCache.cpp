@@ -4,10 +4,15 @@
 
 #include "Core/AccelByteHttpCache.h"
 #include "Interfaces/IHttpResponse.h"
-#include "Kismet/GameplayStatics.h"
 #include "Core/AccelByteLRUCacheFile.h"
 #include "Core/AccelByteLRUCacheMemory.h"
+#include "Core/AccelByteLRUCacheSegment.h"
 #include "Core/AccelByteRegistry.h"
+#include "Core/AccelByteHttpRetryScheduler.h"
+#include "Dom/JsonObject.h"
+#include "Misc/Base64.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteHttpCache, Log, All);
 DEFINE_LOG_CATEGORY(LogAccelByteHttpCache);
@@ -37,6 +42,10 @@ namespace AccelByte
 				// Directives to makes the request conditional
 				const FString IfNoneMatch = TEXT("If-None-Match");
 
+				// Request headers that select the response, besides the method and the URL
+				const FString Vary = TEXT("Vary");
+				const FString Authorization = TEXT("Authorization");
+
 				namespace ControlDirective
 				{
 					
@@ -60,66 +69,340 @@ namespace AccelByte
 
 					// the response can be stored in caches and can be reused while fresh. Once it becomes stale, it must be validated with the origin server before reuse
 					const FString MustRevalidate = TEXT("must-revalidate");
+
+					// the stale response can be served for N seconds while it is revalidated in background
+					const FString StaleWhileRevalidate = TEXT("stale-while-revalidate");
+
+					// the stale response can be served for N seconds when the revalidation fails with an error
+					const FString StaleIfError = TEXT("stale-if-error");
 				}
 			}
 
 			namespace Verb
 			{
+				const FString Get = TEXT("GET");
+				const FString Head = TEXT("HEAD");
 				const FString Delete = TEXT("DELETE");
 			}
 
 		}
 		
+		FAccelByteHttpCacheStats& FAccelByteHttpCacheStats::operator+=(const FAccelByteHttpCacheStats& Other)
+		{
+			HitNum += Other.HitNum;
+			StaleHitNum += Other.StaleHitNum;
+			MissNum += Other.MissNum;
+			NegativeHitNum += Other.NegativeHitNum;
+			NotModifiedNum += Other.NotModifiedNum;
+			ModifiedNum += Other.ModifiedNum;
+			CountEvictionNum += Other.CountEvictionNum;
+			SizeEvictionNum += Other.SizeEvictionNum;
+			ResidentBytes += Other.ResidentBytes;
+			EntryNum += Other.EntryNum;
+			NegativeEntryNum += Other.NegativeEntryNum;
+			return *this;
+		}
+
 		FAccelByteHttpCache::FAccelByteHttpCache()
-			: CachedItemsInternal {nullptr}
 		{
+			for (int32 ShardIndex = 0; ShardIndex < ShardNum; ShardIndex++)
+			{
+				Shards[ShardIndex].Index = ShardIndex;
+				Shards[ShardIndex].CritSection = &GetSharedShard(ShardIndex).CritSection;
+			}
 		}
 
 		FAccelByteHttpCache::~FAccelByteHttpCache()
 		{
-			// empty
+			// The storage might be shared with the other caches, its reference is only released under the lock
+			for (FShard& Shard : Shards)
+			{
+				FScopeLock Lock(Shard.CritSection);
+				Shard.CachedItemsInternal.Reset();
+			}
 		};
 
+		FAccelByteHttpCache::FSharedShard& FAccelByteHttpCache::GetSharedShard(int32 ShardIndex)
+		{
+			static FSharedShard SharedShards[ShardNum];
+			return SharedShards[ShardIndex];
+		}
+
 		void FAccelByteHttpCache::InitializeFromConfig()
+		{
+			for (FShard& Shard : Shards)
+			{
+				FScopeLock Lock(Shard.CritSection);
+				GetCachedItems(Shard);
+			}
+		}
+
+		TSharedPtr<FAccelByteLRUCache<FAccelByteHttpCacheItem>> FAccelByteHttpCache::CreateCachedItems(int32 ShardIndex)
 		{
 			switch (FRegistry::Settings.HttpCacheType)
 			{
 			case EHttpCacheType::MEMORY:
-				CachedItemsInternal = MakeShareable<FAccelByteLRUCacheMemory<FAccelByteHttpCacheItem>>(new FAccelByteLRUCacheMemory<FAccelByteHttpCacheItem>());
-				return;
+			{
+				// The pool allocation keeps the cached responses inside a fixed size arena
+				bool bUseMemoryPool = false;
+				int32 MemoryPoolSize = 20 * 1024 * 1024;
+				int32 MemoryPoolChunkCount = 100;
+				GConfig->GetBool(TEXT("HTTP"), TEXT("UseHttpCacheMemoryPool"), bUseMemoryPool, GEngineIni);
+				GConfig->GetInt(TEXT("HTTP"), TEXT("HttpCacheMemoryPoolSize"), MemoryPoolSize, GEngineIni);
+				GConfig->GetInt(TEXT("HTTP"), TEXT("HttpCacheMemoryPoolChunkCount"), MemoryPoolChunkCount, GEngineIni);
+
+				const MemoryConstructionParameter Param
+				{
+					bUseMemoryPool ? MemoryMethod::PoolAllocation : MemoryMethod::Dynamic,
+					static_cast<size_t>(GetShardLimit(MemoryPoolSize, MinShardSizeBytes)),
+					GetShardLimit(MemoryPoolChunkCount, MinShardEntryNum)
+				};
+				return MakeShareable<FAccelByteLRUCacheMemory<FAccelByteHttpCacheItem>>(new FAccelByteLRUCacheMemory<FAccelByteHttpCacheItem>(Param));
+			}
 			case EHttpCacheType::STORAGE:
 			default:
-				CachedItemsInternal = MakeShareable<FAccelByteLRUCacheFile<FAccelByteHttpCacheItem>>(new FAccelByteLRUCacheFile<FAccelByteHttpCacheItem>());
+			{
+				// The segment store keeps the cached responses across sessions, one store per shard for the whole process
+				FSharedShard& SharedShard = GetSharedShard(ShardIndex);
+				if (TSharedPtr<FAccelByteLRUCache<FAccelByteHttpCacheItem>> PersistentItems = SharedShard.PersistentItems.Pin())
+				{
+					return PersistentItems;
+				}
+
+				int32 StorageMaxSize = 10 * 1024 * 1024;
+				int32 StorageMaxCount = 100;
+				GConfig->GetInt(TEXT("HTTP"), TEXT("HttpCacheStorageMaxSize"), StorageMaxSize, GEngineIni);
+				GConfig->GetInt(TEXT("HTTP"), TEXT("HttpCacheStorageMaxCount"), StorageMaxCount, GEngineIni);
+
+				const FString StoreName = FString::Printf(TEXT("AccelByteHttpCache.%d"), ShardIndex);
+				TSharedPtr<FAccelByteLRUCache<FAccelByteHttpCacheItem>> PersistentItems = MakeShareable<FAccelByteLRUCacheSegment<FAccelByteHttpCacheItem>>(new FAccelByteLRUCacheSegment<FAccelByteHttpCacheItem>(
+					GetShardLimit(StorageMaxCount, MinShardEntryNum),
+					static_cast<size_t>(GetShardLimit(StorageMaxSize, MinShardSizeBytes)),
+					StoreName));
+				SharedShard.PersistentItems = PersistentItems;
+				return PersistentItems;
+			}
+			}
+		}
+
+		int32 FAccelByteHttpCache::GetShardLimit(int32 ConfiguredLimit, int32 MinShardLimit)
+		{
+			// A limit of zero still disables the cache
+			if (ConfiguredLimit <= 0)
+			{
+				return 0;
+			}
+			return FMath::Max(ConfiguredLimit / ShardNum, MinShardLimit);
+		}
+
+		FAccelByteHttpCache::FShard& FAccelByteHttpCache::GetShard(const FAccelByteCacheKey& Key)
+		{
+			return Shards[GetTypeHash(Key) % ShardNum];
+		}
+
+		TSharedPtr<FAccelByteLRUCache<FAccelByteHttpCacheItem>> FAccelByteHttpCache::GetCachedItems(FShard& Shard)
+		{
+			if (!Shard.CachedItemsInternal.IsValid())
+			{
+				Shard.CachedItemsInternal = CreateCachedItems(Shard.Index);
+			}
+
+			return Shard.CachedItemsInternal;
+		}
+
+		FAccelByteHttpCacheStats FAccelByteHttpCache::GetStats()
+		{
+			FAccelByteHttpCacheStats Output;
+			for (FShard& Shard : Shards)
+			{
+				FScopeLock Lock(Shard.CritSection);
+				Output += Shard.Stats;
+
+				const auto& CachedItems = Shard.CachedItemsInternal;
+				if (CachedItems.IsValid())
+				{
+					Output.CountEvictionNum += CachedItems->GetCountEvictionNum() - Shard.CountEvictionBase;
+					Output.SizeEvictionNum += CachedItems->GetSizeEvictionNum() - Shard.SizeEvictionBase;
+					Output.ResidentBytes += static_cast<int64>(CachedItems->GetResidentBytes());
+					Output.EntryNum += CachedItems->GetEntryNum();
+				}
+			}
+
+			FScopeLock Lock(&NegativeCritSection);
+			Output.NegativeEntryNum = NegativeEntries.Num();
+			return Output;
+		}
+
+		TMap<FString, FAccelByteHttpCacheStats> FAccelByteHttpCache::GetRouteStats()
+		{
+			FScopeLock Lock(&RouteStatsCritSection);
+			return RouteStats;
+		}
+
+		void FAccelByteHttpCache::ResetStats()
+		{
+			for (FShard& Shard : Shards)
+			{
+				FScopeLock Lock(Shard.CritSection);
+				Shard.Stats = FAccelByteHttpCacheStats{};
+
+				const auto& CachedItems = Shard.CachedItemsInternal;
+				Shard.CountEvictionBase = CachedItems.IsValid() ? CachedItems->GetCountEvictionNum() : 0;
+				Shard.SizeEvictionBase = CachedItems.IsValid() ? CachedItems->GetSizeEvictionNum() : 0;
+			}
+
+			FScopeLock Lock(&RouteStatsCritSection);
+			RouteStats.Empty();
+		}
+
+		void FAccelByteHttpCache::SetNegativeCachePolicy(bool bEnabled, int32 TtlSeconds, int32 MaxEntryNum)
+		{
+			FScopeLock Lock(&NegativeCritSection);
+			bIsNegativeCacheConfigLoaded = true;
+			bIsNegativeCacheEnabled = bEnabled;
+			NegativeCacheTtlSeconds = FMath::Max(TtlSeconds, 0);
+			NegativeCacheMaxEntryNum = FMath::Max(MaxEntryNum, 0);
+
+			if (!bIsNegativeCacheEnabled)
+			{
+				NegativeEntries.Empty();
+			}
+		}
+
+		void FAccelByteHttpCache::LoadNegativeCacheConfig()
+		{
+			if (bIsNegativeCacheConfigLoaded)
+			{
 				return;
 			}
+			bIsNegativeCacheConfigLoaded = true;
+
+			GConfig->GetBool(TEXT("HTTP"), TEXT("bEnableHttpNegativeCache"), bIsNegativeCacheEnabled, GEngineIni);
+			GConfig->GetInt(TEXT("HTTP"), TEXT("HttpNegativeCacheTtlSeconds"), NegativeCacheTtlSeconds, GEngineIni);
+			GConfig->GetInt(TEXT("HTTP"), TEXT("HttpNegativeCacheMaxCount"), NegativeCacheMaxEntryNum, GEngineIni);
+			NegativeCacheTtlSeconds = FMath::Max(NegativeCacheTtlSeconds, 0);
+			NegativeCacheMaxEntryNum = FMath::Max(NegativeCacheMaxEntryNum, 0);
 		}
 
-		TSharedPtr<FAccelByteLRUCache<FAccelByteHttpCacheItem>> FAccelByteHttpCache::GetCachedItems()
+		bool FAccelByteHttpCache::IsNegativeResponse(const FHttpRequestPtr& CompletedRequest)
 		{
-			if (!CachedItemsInternal.IsValid())
+			const FHttpResponsePtr ResponsePtr = CompletedRequest->GetResponse();
+			if (ResponsePtr == nullptr || !CompletedRequest->GetVerb().Equals(HTTPHeader::Verb::Get, ESearchCase::IgnoreCase))
 			{
-				InitializeFromConfig();
+				return false;
 			}
 
-			return CachedItemsInternal;
+			const int32 ResponseCode = ResponsePtr->GetResponseCode();
+			return ResponseCode == EHttpResponseCodes::NotFound || ResponseCode == EHttpResponseCodes::Gone;
 		}
 
-		FAccelByteHttpCacheItem* FAccelByteHttpCache::GetSerializedHttpCache(const FHttpRequestPtr& Request)
+		FHttpRequestPtr FAccelByteHttpCache::FindNegativeEntry(const FAccelByteCacheKey& Key)
 		{
-			auto const& CachedItems = GetCachedItems();
-			FName const Key = ConstructKey(Request);
-			if (CachedItems->Contains(Key))
+			FScopeLock Lock(&NegativeCritSection);
+			LoadNegativeCacheConfig();
+
+			const FNegativeCacheEntry* Entry = NegativeEntries.Find(Key);
+			if (Entry == nullptr)
 			{
-				auto CachedItem = CachedItems->Find(Key);
-				if (CachedItem.IsValid())
+				return nullptr;
+			}
+
+			if (Entry->ExpireTime < FPlatformTime::Seconds())
+			{
+				NegativeEntries.Remove(Key);
+				return nullptr;
+			}
+
+			return Entry->Request;
+		}
+
+		bool FAccelByteHttpCache::TryStoringNegative(const FAccelByteCacheKey& Key, const FHttpRequestPtr& Request, const FAccelByteHttpCachePolicy& Policy)
+		{
+			FScopeLock Lock(&NegativeCritSection);
+			LoadNegativeCacheConfig();
+
+			if (!bIsNegativeCacheEnabled || NegativeCacheMaxEntryNum <= 0 || Policy.bNoStore)
+			{
+				return false;
+			}
+
+			// The server can only shorten the lifetime, a missing resource might be created at any time
+			const int32 TtlSeconds = Policy.MaxAge >= 0 ? FMath::Min(Policy.MaxAge, NegativeCacheTtlSeconds) : NegativeCacheTtlSeconds;
+			if (TtlSeconds <= 0)
+			{
+				return false;
+			}
+
+			const double TimeNow = FPlatformTime::Seconds();
+			if (!NegativeEntries.Contains(Key) && NegativeEntries.Num() >= NegativeCacheMaxEntryNum)
+			{
+				for (auto It = NegativeEntries.CreateIterator(); It; ++It)
+				{
+					if (It.Value().ExpireTime < TimeNow)
+					{
+						It.RemoveCurrent();
+					}
+				}
+			}
+
+			// Every entry gets the same lifetime, so the closest to expire is also the oldest
+			while (!NegativeEntries.Contains(Key) && NegativeEntries.Num() >= NegativeCacheMaxEntryNum)
+			{
+				const FAccelByteCacheKey* OldestKey = nullptr;
+				double OldestExpireTime = 0.0;
+				for (const auto& Entry : NegativeEntries)
 				{
-					return CachedItem.Get();
+					if (OldestKey == nullptr || Entry.Value.ExpireTime < OldestExpireTime)
+					{
+						OldestKey = &Entry.Key;
+						OldestExpireTime = Entry.Value.ExpireTime;
+					}
 				}
+				NegativeEntries.Remove(FAccelByteCacheKey(*OldestKey));
 			}
-			return nullptr;
+
+			NegativeEntries.Add(Key, FNegativeCacheEntry{ Request, TimeNow + TtlSeconds });
+			return true;
+		}
+
+		void FAccelByteHttpCache::RecordRequest(FShard& Shard, const FHttpRequestPtr& Request, int64 FAccelByteHttpCacheStats::* Counter)
+		{
+			Shard.Stats.*Counter += 1;
+
+			const FString Route = FHttpRetryScheduler::GetRequestRoute(Request->GetURL());
+			FScopeLock Lock(&RouteStatsCritSection);
+			RouteStats.FindOrAdd(Route).*Counter += 1;
+		}
+
+		TSharedPtr<FAccelByteHttpCacheItem> FAccelByteHttpCache::GetSerializedHttpCache(const FHttpRequestPtr& Request)
+		{
+			FAccelByteCacheKey const Key = ConstructKey(Request);
+			FShard& Shard = GetShard(Key);
+			FScopeLock Lock(Shard.CritSection);
+
+			return GetCachedItems(Shard)->Find(Key);
+		}
+
+		bool FAccelByteHttpCache::IsRevalidationRequest(const FAccelByteCacheKey& Key, const FHttpRequestPtr& Request)
+		{
+			FScopeLock Lock(&RevalidationCritSection);
+
+			const FHttpRequestPtr* RevalidationRequest = RevalidationRequests.Find(Key);
+			return RevalidationRequest != nullptr && *RevalidationRequest == Request;
 		}
 
 		bool FAccelByteHttpCache::IsResponseCacheable(const FHttpRequestPtr& CompletedRequest)
+		{
+			if (CompletedRequest->GetResponse() == nullptr)
+			{
+				UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Request has not receive response yet"));
+				return false;
+			}
+
+			return IsResponseCacheable(CompletedRequest, ParseCachePolicy(CompletedRequest->GetResponse()));
+		}
+
+		bool FAccelByteHttpCache::IsResponseCacheable(const FHttpRequestPtr& CompletedRequest, const FAccelByteHttpCachePolicy& Policy)
 		{
 			if (CompletedRequest->GetVerb() == HTTPHeader::Verb::Delete)
 			{
@@ -141,291 +424,593 @@ namespace AccelByte
 				return false;
 			}
 
-			bool bCacheable = true;
-			const FString CacheControlHeader = ResponsePtr->GetHeader(HTTPHeader::Cache::Control);
-			if (!CacheControlHeader.IsEmpty())
+			if (!Policy.bHasCacheControl)
 			{
-				// check hard prevention (no-store)
-				bCacheable = !CacheControlHeader.Contains(HTTPHeader::Cache::ControlDirective::NoStore);
-				// re-check the requirement (immutable)
-				if (CacheControlHeader.Contains(HTTPHeader::Cache::ControlDirective::Immutable))
+				//@TODO atm default behavior is to cache, even without CacheControl directives, might be better to
+				// follow the convention only caching with valid cache control directive. so we dont need to handle valid verb manually
+				UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Response has empty CacheControlHeader"));
+				return false;
+			}
+
+			// check hard prevention (no-store), re-check the requirement (immutable)
+			bool bCacheable = !Policy.bNoStore || Policy.bImmutable;
+			if (bCacheable && Policy.MaxAge >= 0)
+			{
+				bCacheable = Policy.MaxAge > MaxAgeCacheThreshold;
+				UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Max Age %d > Threshold %d"), Policy.MaxAge, MaxAgeCacheThreshold);
+			}
+
+			return bCacheable;
+		}
+
+		FAccelByteHttpCachePolicy FAccelByteHttpCache::ParseCachePolicy(const FHttpResponsePtr& Response)
+		{
+			FAccelByteHttpCachePolicy Policy;
+			if (!Response.IsValid())
+			{
+				return Policy;
+			}
+
+			const FString CacheControlHeader = Response->GetHeader(HTTPHeader::Cache::Control);
+			Policy.bHasCacheControl = !CacheControlHeader.IsEmpty();
+
+			TArray<FString> Directives;
+			CacheControlHeader.ParseIntoArray(Directives, TEXT(","));
+			for (const FString& Directive : Directives)
+			{
+				FString Name = Directive;
+				FString Value;
+				Directive.Split(TEXT("="), &Name, &Value);
+				Name.TrimStartAndEndInline();
+
+				if (Name.Equals(HTTPHeader::Cache::ControlDirective::MaxAge, ESearchCase::IgnoreCase))
 				{
-					bCacheable = true;
+					Value.TrimStartAndEndInline();
+					Policy.MaxAge = FMath::Max(FCString::Atoi(*Value.TrimQuotes()), 0);
 				}
-				if (bCacheable)
+				else if (Name.Equals(HTTPHeader::Cache::ControlDirective::StaleWhileRevalidate, ESearchCase::IgnoreCase))
 				{
-					FString MaxAge = ExtractControlDirective(CacheControlHeader, HTTPHeader::Cache::ControlDirective::MaxAge);
-
-					if (MaxAge.IsEmpty() == false)
-					{
-						const int MaxAgeValue = FCString::Atoi(*MaxAge);
-						bCacheable = bCacheable && MaxAgeValue > MaxAgeCacheThreshold;
-						UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Max Age %d > Threshold %d"), MaxAgeValue, MaxAgeCacheThreshold);
-					}
+					Value.TrimStartAndEndInline();
+					Policy.StaleWhileRevalidate = FMath::Max(FCString::Atoi(*Value.TrimQuotes()), 0);
+				}
+				else if (Name.Equals(HTTPHeader::Cache::ControlDirective::StaleIfError, ESearchCase::IgnoreCase))
+				{
+					Value.TrimStartAndEndInline();
+					Policy.StaleIfError = FMath::Max(FCString::Atoi(*Value.TrimQuotes()), 0);
+				}
+				else if (Name.Equals(HTTPHeader::Cache::ControlDirective::NoCache, ESearchCase::IgnoreCase))
+				{
+					Policy.bNoCache = true;
+				}
+				else if (Name.Equals(HTTPHeader::Cache::ControlDirective::NoStore, ESearchCase::IgnoreCase))
+				{
+					Policy.bNoStore = true;
+				}
+				else if (Name.Equals(HTTPHeader::Cache::ControlDirective::MustRevalidate, ESearchCase::IgnoreCase))
+				{
+					Policy.bMustRevalidate = true;
+				}
+				else if (Name.Equals(HTTPHeader::Cache::ControlDirective::Immutable, ESearchCase::IgnoreCase))
+				{
+					Policy.bImmutable = true;
+				}
+				else if (Name.Equals(HTTPHeader::Cache::ControlDirective::Private, ESearchCase::IgnoreCase))
+				{
+					Policy.bPrivate = true;
+				}
+				else if (Name.Equals(HTTPHeader::Cache::ControlDirective::Public, ESearchCase::IgnoreCase))
+				{
+					Policy.bPublic = true;
 				}
-				UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Response has valid CacheControlHeader: %s"),*CacheControlHeader);
 			}
-			else 
+
+			const FString CacheAge = Response->GetHeader(HTTPHeader::Cache::Age);
+			if (!CacheAge.IsEmpty())
 			{
-				//@TODO atm default behavior is to cache, even without CacheControl directives, might be better to
-				// follow the convention only caching with valid cache control directive. so we dont need to handle valid verb manually
-				bCacheable = false;
-				UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Response has empty CacheControlHeader"));
+				Policy.Age = FMath::Max(FCString::Atoi(*CacheAge), 0);
 			}
-		
-			return bCacheable;
+
+			// Expires is only used without max-age, relative to the Date of the response to avoid clock skew
+			FDateTime ExpiresDate;
+			if (Policy.MaxAge < 0 && FDateTime::ParseHttpDate(Response->GetHeader(HTTPHeader::Cache::Expires), ExpiresDate))
+			{
+				FDateTime ResponseDate;
+				if (!FDateTime::ParseHttpDate(Response->GetHeader(HTTPHeader::Cache::Date), ResponseDate))
+				{
+					ResponseDate = FDateTime::UtcNow();
+				}
+				Policy.ExpiresIn = FMath::Max(static_cast<int32>((ExpiresDate - ResponseDate).GetTotalSeconds()), 0);
+			}
+
+			Policy.ETag = Response->GetHeader(HTTPHeader::Cache::ETag);
+
+			return Policy;
 		}
 
 		bool FAccelByteHttpCache::TryRetrieving(FHttpRequestPtr& Out, FHttpResponsePtr& OutCachedResponse)
 		{
-			FScopeTryLock TryLock(&CacheCritSection);
+			bool bShouldRevalidate = false;
+			return TryRetrieving(Out, OutCachedResponse, bShouldRevalidate);
+		}
 
+		bool FAccelByteHttpCache::TryRetrieving(FHttpRequestPtr& Out, FHttpResponsePtr& OutCachedResponse, bool& bOutShouldRevalidate)
+		{
 			bool bRetrieved = false;
-			auto const& CachedItems = GetCachedItems();
+			bOutShouldRevalidate = false;
+
+			const FAccelByteCacheKey Key = ConstructKey(Out);
+			const bool bIsRevalidationRequest = IsRevalidationRequest(Key, Out);
+
+			FShard& Shard = GetShard(Key);
+			FScopeLock Lock(Shard.CritSection);
+			auto const& CachedItems = GetCachedItems(Shard);
+
+			// The background revalidation must reach the server, only make it conditional
+			if (bIsRevalidationRequest)
+			{
+				auto CachedItem = CachedItems->Peek(Key);
+				if (CachedItem.IsValid() && !CachedItem->Policy.ETag.IsEmpty())
+				{
+					Out->SetHeader(HTTPHeader::Cache::IfNoneMatch, CachedItem->Policy.ETag);
+				}
+				return bRetrieved;
+			}
 
-			const FName Key = ConstructKey(Out);
-			if (CachedItems->Contains(Key))
+			auto CachedItem = CachedItems->Find(Key);
+			if (!CachedItem.IsValid())
 			{
-				auto CachedItem = CachedItems->Find(Key);
-				if (CheckCachedItemFreshness(Key) == EHttpCacheFreshness::FRESH)
+				const FHttpRequestPtr NegativeRequest = FindNegativeEntry(Key);
+				if (NegativeRequest.IsValid())
 				{
-					Out = CachedItem->Request;
-					OutCachedResponse = CachedItem->Request->GetResponse();
+					RecordRequest(Shard, Out, &FAccelByteHttpCacheStats::NegativeHitNum);
+					Out = NegativeRequest;
+					OutCachedResponse = NegativeRequest->GetResponse();
 
 					bRetrieved = true;
-					UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Valid cached response found, will return that instead of sending request"));
+					UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Cached %d response found, will return that instead of sending request"), OutCachedResponse->GetResponseCode());
+					return bRetrieved;
 				}
-				else if (CheckCachedItemFreshness(Key) == EHttpCacheFreshness::WAITING_REFRESH)
-				{
-					if (CachedItem == nullptr) return bRetrieved;
-					if (CachedItem->Request.IsValid() == false) return bRetrieved;
-					if (CachedItem->Request->GetResponse().IsValid() == false) return bRetrieved;
 
-					auto ETagValue = CachedItem->Request->GetResponse()->GetHeader(HTTPHeader::Cache::ETag);
-					if (ETagValue.IsEmpty()) return bRetrieved;
+				RecordRequest(Shard, Out, &FAccelByteHttpCacheStats::MissNum);
+				return bRetrieved;
+			}
+
+			const EHttpCacheFreshness Freshness = CheckCachedItemFreshness(*CachedItems, Key, *CachedItem);
+			if (Freshness == EHttpCacheFreshness::FRESH || Freshness == EHttpCacheFreshness::STALE_WHILE_REVALIDATE)
+			{
+				RecordRequest(Shard, Out, Freshness == EHttpCacheFreshness::FRESH ? &FAccelByteHttpCacheStats::HitNum : &FAccelByteHttpCacheStats::StaleHitNum);
+				Out = CachedItem->Request;
+				OutCachedResponse = CachedItem->Request->GetResponse();
 
-					Out->AppendToHeader(HTTPHeader::Cache::IfNoneMatch, ETagValue);
+				bRetrieved = true;
+				bOutShouldRevalidate = Freshness == EHttpCacheFreshness::STALE_WHILE_REVALIDATE;
+				UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Valid cached response found, will return that instead of sending request"));
+			}
+			else
+			{
+				RecordRequest(Shard, Out, &FAccelByteHttpCacheStats::MissNum);
+				if (Freshness == EHttpCacheFreshness::WAITING_REFRESH && !CachedItem->Policy.ETag.IsEmpty())
+				{
+					Out->AppendToHeader(HTTPHeader::Cache::IfNoneMatch, CachedItem->Policy.ETag);
 				}
-	
 			}
 
 			return bRetrieved;
 		}
 
-		bool FAccelByteHttpCache::TryStoring(const FHttpRequestPtr& Request)
+		bool FAccelByteHttpCache::TryRetrievingFallback(const FHttpRequestPtr& Request, FHttpResponsePtr& OutCachedResponse)
 		{
-			FScopeTryLock TryLock(&CacheCritSection);
+			const FAccelByteCacheKey Key = ConstructKey(Request);
+			FShard& Shard = GetShard(Key);
+			FScopeLock Lock(Shard.CritSection);
 
-			const FHttpResponsePtr Response = Request.Get()->GetResponse();
-			if (Response != nullptr && IsResponseCacheable(Request))
+			auto CachedItem = GetCachedItems(Shard)->Peek(Key);
+			if (!CachedItem.IsValid())
 			{
-				const FName Key = ConstructKey(Request);
+				return false;
+			}
 
-				int TimeInProxyCache = 0;
-				const FString CacheAge = Response->GetHeader(HTTPHeader::Cache::Age);
-				if (!CacheAge.IsEmpty())
+			const FHttpResponsePtr Response = Request->GetResponse();
+			const bool bIsNotModified = Response.IsValid() && Response->GetResponseCode() == EHttpResponseCodes::NotModified;
+			if (!bIsNotModified)
+			{
+				// Only a connection error or a server error can be covered by stale-if-error
+				if (Response.IsValid() && Response->GetResponseCode() < EHttpResponseCodes::ServerError)
 				{
-					TimeInProxyCache = FCString::Atoi(*CacheAge);
+					return false;
 				}
 
-				double ResponseAgeThreshold = 0;
-				FString CacheControlHeader = Response->GetHeader(HTTPHeader::Cache::Control);
-				if (CacheControlHeader.IsEmpty() == false)
+				const FAccelByteHttpCachePolicy& Policy = CachedItem->Policy;
+				if (Policy.bMustRevalidate || Policy.StaleIfError < 0 || FPlatformTime::Seconds() > CachedItem->ExpireTime + Policy.StaleIfError)
 				{
-					FString MaxAge = ExtractControlDirective(CacheControlHeader, HTTPHeader::Cache::ControlDirective::MaxAge);
-					if (MaxAge.IsEmpty() == false)
-					{
-						int ResponseAgeThresholdInt = FCString::Atoi(*MaxAge);
-						ResponseAgeThreshold = (double)ResponseAgeThresholdInt;
-					}
+					return false;
 				}
+				UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Request for [%s] failed, serving the stale cached response"), *Key.ToString());
+				RecordRequest(Shard, Request, &FAccelByteHttpCacheStats::StaleHitNum);
+			}
 
-				FAccelByteHttpCacheItem NewCacheItem;
-				const double TimeNow = FPlatformTime::Seconds();
-				NewCacheItem.ExpireTime = TimeNow + ResponseAgeThreshold - TimeInProxyCache;
-				
-				auto const& CachedItems = GetCachedItems();
-
-				// IF the response from the online storage service return 304
-				// THEN we can reuse the old cache and extend the usage because the response should be same
-				if (Response->GetResponseCode() == EHttpResponseCodes::NotModified &&
-					CachedItems->Contains(Key))
-				{
-					auto CurrentCachedItem = CachedItems->Find(Key);
-					
-					TArray<FString> TransferredHeaders = {
-						HTTPHeader::Cache::Control,
-						HTTPHeader::Cache::ContentLocation,
-						HTTPHeader::Cache::Date,
-						HTTPHeader::Cache::ETag,
-						HTTPHeader::Cache::Expires
-					};
-
-					if (CacheControlHeader.IsEmpty() == false)
-					{
-						for (auto Header : TransferredHeaders)
-						{
-							FString Value = ExtractControlDirective(CacheControlHeader, Header);
-							if (Value.IsEmpty() == false)
-							{
-								CurrentCachedItem->Request->AppendToHeader(Header, Value);
-							}
-						}
-					}
-					
-					CurrentCachedItem->ExpireTime = NewCacheItem.ExpireTime;
-					UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Response for request [%s] is now extended using the same cached response"), *Response->GetURL());
-				}
-				else
-				{
-					NewCacheItem.Request = Request;
-					CachedItems->Emplace(Key, NewCacheItem);
-					UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Response for request [%s] is now cached"),*Response->GetURL());
-				}
+			OutCachedResponse = CachedItem->Request->GetResponse();
+			return true;
+		}
+
+		bool FAccelByteHttpCache::StartRevalidation(const FHttpRequestPtr& RevalidationRequest)
+		{
+			FScopeLock Lock(&RevalidationCritSection);
 
+			const FAccelByteCacheKey Key = ConstructKey(RevalidationRequest);
+			if (RevalidationRequests.Contains(Key))
+			{
+				return false;
 			}
+			RevalidationRequests.Add(Key, RevalidationRequest);
+			return true;
+		}
 
-			return false;
+		void FAccelByteHttpCache::FinishRevalidation(const FHttpRequestPtr& RevalidationRequest)
+		{
+			FScopeLock Lock(&RevalidationCritSection);
+
+			const FAccelByteCacheKey Key = ConstructKey(RevalidationRequest);
+			const FHttpRequestPtr* Existing = RevalidationRequests.Find(Key);
+			if (Existing != nullptr && *Existing == RevalidationRequest)
+			{
+				RevalidationRequests.Remove(Key);
+			}
 		}
 
-		void FAccelByteHttpCache::ClearCache()
+		void FAccelByteHttpCache::RemoveReadEntries(const FHttpRequestPtr& WriteRequest)
 		{
-			if (CachedItemsInternal.IsValid())
+			const FAccelByteCacheKey Key = ConstructKey(WriteRequest, HTTPHeader::Verb::Get);
 			{
-				CachedItemsInternal->Empty();
+				FShard& Shard = GetShard(Key);
+				FScopeLock Lock(Shard.CritSection);
+				GetCachedItems(Shard)->Remove(Key);
 			}
+
+			FScopeLock Lock(&NegativeCritSection);
+			NegativeEntries.Remove(Key);
 		}
 
-		FAccelByteHttpCache::EHttpCacheFreshness FAccelByteHttpCache::CheckCachedItemFreshness(const FName& Key)
+		bool FAccelByteHttpCache::TryStoring(const FHttpRequestPtr& Request)
 		{
-			auto const& CachedItems = GetCachedItems();
-			const TSharedPtr<FAccelByteHttpCacheItem> CachedItemPtr = (CachedItems.Get())->operator[](Key);
-			if (!CachedItems->Contains(Key))
+			const FHttpResponsePtr Response = Request.Get()->GetResponse();
+			if (Response == nullptr)
 			{
-				return EHttpCacheFreshness::STALE;
+				return false;
 			}
-			
-			if (!CachedItemPtr.IsValid())
+
+			// A successful write changes the resource, what was cached from reading it is outdated
+			const FString RequestVerb = Request->GetVerb();
+			const int32 ResponseCode = Response->GetResponseCode();
+			if (!RequestVerb.Equals(HTTPHeader::Verb::Get, ESearchCase::IgnoreCase)
+				&& !RequestVerb.Equals(HTTPHeader::Verb::Head, ESearchCase::IgnoreCase)
+				&& ResponseCode >= EHttpResponseCodes::Ok && ResponseCode < EHttpResponseCodes::Ambiguous)
 			{
-				return EHttpCacheFreshness::STALE;
+				RemoveReadEntries(Request);
 			}
-			const FAccelByteHttpCacheItem CachedItem = *CachedItemPtr;
 
-			const double TimeNow = FPlatformTime::Seconds();
-			bool bIsStaleResponse = false;
-			EHttpCacheFreshness Freshness = EHttpCacheFreshness::FRESH;
+			// The directives are parsed once here, the lookups only compare the parsed values
+			const FAccelByteHttpCachePolicy Policy = ParseCachePolicy(Response);
 
-			// check RESPONSE cache-control directive
-			const FHttpResponsePtr CachedResponse = CachedItem.Request->GetResponse();
-			FString ResponseCacheControlHeader = "";
-			if (CachedResponse == nullptr)
+			// A 304 doesn't have to repeat the Vary header, the stored one still applies
+			if (Response->GetResponseCode() != EHttpResponseCodes::NotModified && !UpdateVaryHeaders(Request, Response))
 			{
-				for (int i = 0 ; i < CachedItem.SerializableRequestAndResponse.ResponseHeaders.Num() ; i ++)
-				{
-					const FString& Header = CachedItem.SerializableRequestAndResponse.ResponseHeaders[i];
-					if (Header.Contains(HTTPHeader::Cache::Control))
-					{
-						FString HeaderKey, Value;
-						Header.Split(":", &HeaderKey, &Value);
-						Value = Value.TrimStartAndEnd();
-
-						ResponseCacheControlHeader = Value;
-					}
-				}
+				return false;
 			}
-			else
+
+			const FAccelByteCacheKey Key = ConstructKey(Request);
+			FShard& Shard = GetShard(Key);
+			FScopeLock Lock(Shard.CritSection);
+
+			// A conditional request revalidates the cached response
+			if (!Request->GetHeader(HTTPHeader::Cache::IfNoneMatch).IsEmpty())
 			{
-				ResponseCacheControlHeader = CachedResponse->GetHeader(HTTPHeader::Cache::Control);
+				const bool bIsNotModified = Response->GetResponseCode() == EHttpResponseCodes::NotModified;
+				RecordRequest(Shard, Request, bIsNotModified ? &FAccelByteHttpCacheStats::NotModifiedNum : &FAccelByteHttpCacheStats::ModifiedNum);
 			}
 
-			if (ResponseCacheControlHeader.Contains(HTTPHeader::Cache::ControlDirective::Immutable))
+			if (IsNegativeResponse(Request))
 			{
-				bIsStaleResponse = false;
-			} 
-			else if (CachedItem.ExpireTime < TimeNow) //Expired
+				if (TryStoringNegative(Key, Request, Policy))
+				{
+					// The resource is gone, the response cached before must not be served anymore
+					GetCachedItems(Shard)->Remove(Key);
+					UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Response %d for request [%s] is now cached"), Response->GetResponseCode(), *Response->GetURL());
+				}
+				return false;
+			}
+
+			if (!IsResponseCacheable(Request, Policy))
 			{
-				bIsStaleResponse = true;
+				return false;
 			}
-			else // Fresh
+
+			const double ExpireTime = FPlatformTime::Seconds() + Policy.GetFreshnessLifetime();
+			auto const& CachedItems = GetCachedItems(Shard);
+
+			// IF the response from the online storage service return 304
+			// THEN we can reuse the old cache and extend the usage because the response should be same
+			if (Response->GetResponseCode() == EHttpResponseCodes::NotModified)
 			{
-				if (!ResponseCacheControlHeader.IsEmpty())
+				auto CurrentCachedItem = CachedItems->Peek(Key);
+				if (CurrentCachedItem.IsValid())
 				{
-					//@TODO this needs to check for validation, for now we are dropping this as stale
-					if (ResponseCacheControlHeader.Contains(HTTPHeader::Cache::ControlDirective::NoCache))
+					// The 304 carries the refreshed directives, the validator is kept when it is not sent again
+					FAccelByteHttpCacheItem RefreshedItem = *CurrentCachedItem;
+					RefreshedItem.Policy = Policy;
+					if (RefreshedItem.Policy.ETag.IsEmpty())
 					{
-						bIsStaleResponse = true;
-						// no-cache 
-						//A cache will send the request to the origin server for validation before releasing a cached copy.
-
-					}
-					else if (ResponseCacheControlHeader.Contains(HTTPHeader::Cache::ControlDirective::MustRevalidate))
-					{
-						// must-revalidate
-						//When using the "must-revalidate" directive, the cache must verify the status of stale resources before using them
-
-						//TODO
-						//Revalidate(Key);
-						bIsStaleResponse = true;
+						RefreshedItem.Policy.ETag = CurrentCachedItem->Policy.ETag;
 					}
+					RefreshedItem.ExpireTime = ExpireTime;
 
-					//The "public" directive indicates that the response may be cached by any cache. 
-					// This can be useful if pages with HTTP authentication or response status codes that aren't normally cacheable should now be cached.
-					//On the other hand, "private" indicates that the response is intended for a single user only
-					//and must not be stored by a shared cache.A private browser cache may store the response in this case.
+					// Written back since a storage might hand out a copy of the item
+					CachedItems->Emplace(Key, RefreshedItem);
+					UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Response for request [%s] is now extended using the same cached response"), *Response->GetURL());
 				}
 			}
+			else
+			{
+				FAccelByteHttpCacheItem NewCacheItem;
+				NewCacheItem.ExpireTime = ExpireTime;
+				NewCacheItem.Policy = Policy;
+				NewCacheItem.Request = Request;
+				CachedItems->Emplace(Key, NewCacheItem);
+				UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Response for request [%s] is now cached"),*Response->GetURL());
+			}
 
-			if (bIsStaleResponse)
+			return false;
+		}
+
+		void FAccelByteHttpCache::ClearCache(bool bClearPersistentStorage)
+		{
+			for (FShard& Shard : Shards)
 			{
-				// Don't remove the cached item for this KEY yet, it has an ETag an might be refreshed by the following request
-				if (CachedItem.Request->GetResponse().IsValid() &&
-					CachedItem.Request->GetResponse()->GetHeader(HTTPHeader::Cache::ETag).IsEmpty() == false)
+				FScopeLock Lock(Shard.CritSection);
+				if (!Shard.CachedItemsInternal.IsValid())
 				{
-					Freshness = EHttpCacheFreshness::WAITING_REFRESH;
-					UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Cached item [%s] not removed yet, waiting for refresh"), *Key.ToString());
+					continue;
+				}
+
+				if (bClearPersistentStorage)
+				{
+					Shard.CachedItemsInternal->Empty();
 				}
 				else
 				{
-					Freshness = EHttpCacheFreshness::STALE;
-					CachedItems->Remove(Key);
-					UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Removed stale cached item [%s]"), *Key.ToString());
+					// Only release the storage, a persistent storage is recovered on the next initialization
+					Shard.Stats.CountEvictionNum += Shard.CachedItemsInternal->GetCountEvictionNum() - Shard.CountEvictionBase;
+					Shard.Stats.SizeEvictionNum += Shard.CachedItemsInternal->GetSizeEvictionNum() - Shard.SizeEvictionBase;
+					Shard.CountEvictionBase = 0;
+					Shard.SizeEvictionBase = 0;
+
+					Shard.CachedItemsInternal->Flush();
+					Shard.CachedItemsInternal.Reset();
 				}
 			}
 
-			return Freshness;
+			// The negative entries are never persisted
+			FScopeLock Lock(&NegativeCritSection);
+			NegativeEntries.Empty();
+		}
+
+		FAccelByteHttpCache::EHttpCacheFreshness FAccelByteHttpCache::CheckCachedItemFreshness(FAccelByteLRUCache<FAccelByteHttpCacheItem>& CachedItems, const FAccelByteCacheKey& Key, const FAccelByteHttpCacheItem& CachedItem)
+		{
+			const FAccelByteHttpCachePolicy& Policy = CachedItem.Policy;
+			const double TimeNow = FPlatformTime::Seconds();
+
+			if (Policy.bImmutable)
+			{
+				return EHttpCacheFreshness::FRESH;
+			}
+
+			// no-cache: A cache will send the request to the origin server for validation before releasing a cached copy.
+			const bool bIsExpired = CachedItem.ExpireTime < TimeNow;
+			if (!bIsExpired && !Policy.bNoCache)
+			{
+				return EHttpCacheFreshness::FRESH;
+			}
+
+			// must-revalidate: the cache must verify the status of stale resources before using them
+			const bool bCanServeStale = !Policy.bNoCache && !Policy.bMustRevalidate;
+			if (bCanServeStale && Policy.StaleWhileRevalidate >= 0 && TimeNow <= CachedItem.ExpireTime + Policy.StaleWhileRevalidate)
+			{
+				return EHttpCacheFreshness::STALE_WHILE_REVALIDATE;
+			}
+
+			// Don't remove the cached item for this KEY yet, it has an ETag an might be refreshed by the following request,
+			// or it can still be served if that request fails
+			const bool bCanServeOnError = !Policy.bMustRevalidate && Policy.StaleIfError >= 0 && TimeNow <= CachedItem.ExpireTime + Policy.StaleIfError;
+			if (!Policy.ETag.IsEmpty() || bCanServeOnError)
+			{
+				UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Cached item [%s] not removed yet, waiting for refresh"), *Key.ToString());
+				return EHttpCacheFreshness::WAITING_REFRESH;
+			}
+
+			CachedItems.Remove(Key);
+			UE_LOG(LogAccelByteHttpCache, VeryVerbose, TEXT("Removed stale cached item [%s]"), *Key.ToString());
+			return EHttpCacheFreshness::STALE;
 		};
 
-		FName FAccelByteHttpCache::ConstructKey(const FHttpRequestPtr& Request)
+		FAccelByteCacheKey FAccelByteHttpCache::ConstructPrimaryKey(const FHttpRequestPtr& Request, const FString& Verb, FString& OutIdentity)
 		{
-			const FString KeyString = FString::Printf(TEXT("%s-%s")
-				, *Request->GetVerb()
-				, *Request->GetURL()
+			OutIdentity = FString::Printf(TEXT("%s %s\n%s")
+				, *Verb.ToUpper()
+				, *CanonicalizeUrl(Request->GetURL())
+				, *FindAuthorizationSubject(Request->GetHeader(HTTPHeader::Cache::Authorization))
 			);
 
-			const FName Key = FName(*KeyString);
+			FTCHARToUTF8 IdentityUtf8(*OutIdentity);
+			return FAccelByteCacheKey::FromBytes(reinterpret_cast<const uint8*>(IdentityUtf8.Get()), IdentityUtf8.Length());
+		}
 
-			return Key;
+		FAccelByteCacheKey FAccelByteHttpCache::ConstructKey(const FHttpRequestPtr& Request)
+		{
+			return ConstructKey(Request, Request->GetVerb());
 		}
 
-		FString FAccelByteHttpCache::ExtractControlDirective(const FString& CacheControlHeader, const FString& ControlDirective)
+		FAccelByteCacheKey FAccelByteHttpCache::ConstructKey(const FHttpRequestPtr& Request, const FString& Verb)
 		{
-			FString Result = "";
-			TArray<FString> Array;
-			CacheControlHeader.ParseIntoArray(Array, TEXT(","));
-			for (const FString& Directive : Array)
+			FString Identity;
+			const FAccelByteCacheKey PrimaryKey = ConstructPrimaryKey(Request, Verb, Identity);
 			{
-				FString Key, Value;
-				UGameplayStatics::GetKeyValue(CacheControlHeader, Key, Value);
+				FScopeLock Lock(&VaryCritSection);
+				const TArray<FString>* Headers = VaryHeaders.Find(PrimaryKey);
+				if (Headers == nullptr)
+				{
+					return PrimaryKey;
+				}
 
-				if (Key == ControlDirective)
+				for (const FString& Header : *Headers)
 				{
-					Result = Value;
-					break;
+					Identity += FString::Printf(TEXT("\n%s:%s"), *Header, *Request->GetHeader(Header));
 				}
+			}
+
+			FTCHARToUTF8 VaryingIdentityUtf8(*Identity);
+			return FAccelByteCacheKey::FromBytes(reinterpret_cast<const uint8*>(VaryingIdentityUtf8.Get()), VaryingIdentityUtf8.Length());
+		}
 
+		FString FAccelByteHttpCache::CanonicalizeUrl(const FString& Url)
+		{
+			FString Path = Url;
+			int32 FragmentIndex = INDEX_NONE;
+			if (Path.FindChar(TCHAR('#'), FragmentIndex))
+			{
+				Path.LeftInline(FragmentIndex, false);
 			}
 
-			return Result;
+			FString Query;
+			int32 QueryIndex = INDEX_NONE;
+			if (Path.FindChar(TCHAR('?'), QueryIndex))
+			{
+				Query = Path.Mid(QueryIndex + 1);
+				Path.LeftInline(QueryIndex, false);
+			}
+
+			// The scheme and the host are case-insensitive, the path is not
+			const int32 SchemeEnd = Path.Find(TEXT("://"), ESearchCase::CaseSensitive);
+			if (SchemeEnd != INDEX_NONE)
+			{
+				const int32 HostEnd = Path.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromStart, SchemeEnd + 3);
+				const int32 AuthorityLen = HostEnd != INDEX_NONE ? HostEnd : Path.Len();
+				Path = Path.Left(AuthorityLen).ToLower() + Path.Mid(AuthorityLen);
+			}
+
+			TArray<FString> Params;
+			Query.ParseIntoArray(Params, TEXT("&"), true);
+			if (Params.Num() == 0)
+			{
+				return Path;
+			}
+
+			// Only the parameter names are ordered, the values of a repeated parameter keep their order
+			auto GetParamName = [](const FString& Param)
+			{
+				int32 ValueIndex = INDEX_NONE;
+				return Param.FindChar(TCHAR('='), ValueIndex) ? Param.Left(ValueIndex) : Param;
+			};
+			Params.StableSort([&GetParamName](const FString& A, const FString& B)
+			{
+				return GetParamName(A).Compare(GetParamName(B), ESearchCase::CaseSensitive) < 0;
+			});
+
+			return Path + TEXT("?") + FString::Join(Params, TEXT("&"));
+		}
+
+		FString FAccelByteHttpCache::GetAuthorizationSubject(const FString& Authorization)
+		{
+			FString Scheme;
+			FString Token;
+			if (!Authorization.Split(TEXT(" "), &Scheme, &Token) || !Scheme.Equals(TEXT("Bearer"), ESearchCase::IgnoreCase))
+			{
+				return Authorization;
+			}
+
+			TArray<FString> Segments;
+			Token.TrimStartAndEnd().ParseIntoArray(Segments, TEXT("."), false);
+			if (Segments.Num() != 3)
+			{
+				return Authorization;
+			}
+
+			// The JWT payload is base64url without padding
+			FString Payload = Segments[1].Replace(TEXT("-"), TEXT("+")).Replace(TEXT("_"), TEXT("/"));
+			while (Payload.Len() % 4 != 0)
+			{
+				Payload.AppendChar(TCHAR('='));
+			}
+
+			TArray<uint8> PayloadBytes;
+			if (!FBase64::Decode(Payload, PayloadBytes))
+			{
+				return Authorization;
+			}
+
+			const FUTF8ToTCHAR PayloadString(reinterpret_cast<const ANSICHAR*>(PayloadBytes.GetData()), PayloadBytes.Num());
+			TSharedPtr<FJsonObject> Claims;
+			const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FString(PayloadString.Length(), PayloadString.Get()));
+			FString Subject;
+			if (!FJsonSerializer::Deserialize(Reader, Claims) || !Claims.IsValid() || !Claims->TryGetStringField(TEXT("sub"), Subject))
+			{
+				return Authorization;
+			}
+
+			return TEXT("sub:") + Subject;
+		}
+
+		FString FAccelByteHttpCache::FindAuthorizationSubject(const FString& Authorization)
+		{
+			FScopeLock Lock(&AuthorizationSubjectCritSection);
+			if (const FString* Subject = AuthorizationSubjects.Find(Authorization))
+			{
+				return *Subject;
+			}
+
+			if (AuthorizationSubjects.Num() >= MaxAuthorizationSubjectNum)
+			{
+				AuthorizationSubjects.Reset();
+			}
+			return AuthorizationSubjects.Add(Authorization, GetAuthorizationSubject(Authorization));
+		}
+
+		bool FAccelByteHttpCache::UpdateVaryHeaders(const FHttpRequestPtr& Request, const FHttpResponsePtr& Response)
+		{
+			TArray<FString> Headers;
+			Response->GetHeader(HTTPHeader::Cache::Vary).ParseIntoArray(Headers, TEXT(","), true);
+			for (int32 Index = Headers.Num() - 1; Index >= 0; Index--)
+			{
+				Headers[Index] = Headers[Index].TrimStartAndEnd().ToLower();
+				if (Headers[Index] == TEXT("*"))
+				{
+					return false;
+				}
+
+				// The user is always part of the key
+				if (Headers[Index].IsEmpty() || Headers[Index] == HTTPHeader::Cache::Authorization.ToLower())
+				{
+					Headers.RemoveAt(Index, 1, false);
+				}
+			}
+			Headers.Sort();
+
+			FString Identity;
+			const FAccelByteCacheKey PrimaryKey = ConstructPrimaryKey(Request, Request->GetVerb(), Identity);
+
+			FScopeLock Lock(&VaryCritSection);
+			if (Headers.Num() == 0)
+			{
+				VaryHeaders.Remove(PrimaryKey);
+			}
+			else
+			{
+				if (VaryHeaders.Num() >= MaxVaryEntryNum && !VaryHeaders.Contains(PrimaryKey))
+				{
+					VaryHeaders.Empty();
+				}
+				VaryHeaders.Add(PrimaryKey, MoveTemp(Headers));
+			}
+			return true;
 		}
 	} // namespace Core
 
@@ -0,0 +1,90 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteHttpResponseDecoder.h"
+#include "Async/Async.h"
+
+namespace AccelByte
+{
+
+bool FHttpResponseDecoder::bAsyncDecodingEnabled = false;
+int32 FHttpResponseDecoder::MaxDecodeJobs = 2;
+
+FCriticalSection FHttpResponseDecoder::JobsLock;
+int32 FHttpResponseDecoder::DecodeJobNum = 0;
+int32 FHttpResponseDecoder::QueuedDecodeJobNum = 0;
+TQueue<TUniqueFunction<void()>> FHttpResponseDecoder::QueuedJobs;
+
+bool FHttpResponseDecoder::IsAsyncDecoding(EAccelByteHttpResponseDecoding Decoding)
+{
+	switch (Decoding)
+	{
+	case EAccelByteHttpResponseDecoding::Async:
+		return true;
+	case EAccelByteHttpResponseDecoding::GameThread:
+		return false;
+	default:
+		return bAsyncDecodingEnabled;
+	}
+}
+
+void FHttpResponseDecoder::SetMaxDecodeJobs(int32 MaxJobs)
+{
+	FScopeLock Lock(&JobsLock);
+	MaxDecodeJobs = FMath::Max(MaxJobs, 1);
+}
+
+int32 FHttpResponseDecoder::GetDecodeJobNum()
+{
+	FScopeLock Lock(&JobsLock);
+	return DecodeJobNum;
+}
+
+int32 FHttpResponseDecoder::GetQueuedDecodeJobNum()
+{
+	FScopeLock Lock(&JobsLock);
+	return QueuedDecodeJobNum;
+}
+
+void FHttpResponseDecoder::Launch(TUniqueFunction<void()>&& DecodeJob)
+{
+	FScopeLock Lock(&JobsLock);
+	if (DecodeJobNum >= MaxDecodeJobs)
+	{
+		QueuedJobs.Enqueue(MoveTemp(DecodeJob));
+		QueuedDecodeJobNum++;
+		return;
+	}
+
+	DecodeJobNum++;
+	StartJob(MoveTemp(DecodeJob));
+}
+
+void FHttpResponseDecoder::StartJob(TUniqueFunction<void()>&& DecodeJob)
+{
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Job = MoveTemp(DecodeJob)]() mutable
+		{
+			Job();
+			FinishJob();
+		});
+}
+
+void FHttpResponseDecoder::FinishJob()
+{
+	FScopeLock Lock(&JobsLock);
+
+	// Hand the slot over to the oldest queued job
+	TUniqueFunction<void()> NextJob;
+	if (QueuedJobs.Dequeue(NextJob))
+	{
+		QueuedDecodeJobNum--;
+		StartJob(MoveTemp(NextJob));
+	}
+	else
+	{
+		DecodeJobNum--;
+	}
+}
+
+}
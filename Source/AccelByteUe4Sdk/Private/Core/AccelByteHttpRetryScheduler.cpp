@@ -6,10 +6,16 @@
 #include "Core/AccelByteReport.h"
 #include "Core/AccelByteRegistry.h"
 #include "Core/AccelByteHttpRetryTask.h"
+#include "Stats/Stats.h"
 #include <algorithm>
 
 DEFINE_LOG_CATEGORY(LogAccelByteHttpRetry);
 
+// e.g. "stat AccelByteHttp", or Unreal Insights with -trace=cpu,memory to count the allocations within the scope
+DECLARE_STATS_GROUP(TEXT("AccelByteHttp"), STATGROUP_AccelByteHttp, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("ProcessRequest"), STAT_AccelByteHttpProcessRequest, STATGROUP_AccelByteHttp);
+DECLARE_CYCLE_STAT(TEXT("PollRetry"), STAT_AccelByteHttpPollRetry, STATGROUP_AccelByteHttp);
+
 using namespace std;
 
 namespace AccelByte
@@ -20,33 +26,137 @@ int FHttpRetryScheduler::MaximumDelay = 30;
 int FHttpRetryScheduler::TotalTimeout = 60;
 int FHttpRetryScheduler::PauseTimeout = 60;
 int FHttpRetryScheduler::RateLimit = 6;
+int32 FHttpRetryScheduler::RateLimitMaxPendingRequests = 256;
+double FHttpRetryScheduler::RateLimitBucketIdleTimeout = 60.0;
+bool FHttpRetryScheduler::bRequestCoalescingEnabled = false;
+int32 FHttpRetryScheduler::MaxDispatchedRequests[] = { 0, 0, 4 };
+double FHttpRetryScheduler::RetryBudgetRatio = 0.0;
+int32 FHttpRetryScheduler::RetryBudgetMinRetries = 10;
+double FHttpRetryScheduler::RetryBudgetWindow = 10.0;
+bool FHttpRetryScheduler::bCircuitBreakerEnabled = false;
+double FHttpRetryScheduler::CircuitBreakerFailureRate = 0.5;
+int32 FHttpRetryScheduler::CircuitBreakerMinRequests = 20;
+double FHttpRetryScheduler::CircuitBreakerWindow = 10.0;
+double FHttpRetryScheduler::CircuitBreakerOpenDuration = 15.0;
 
 FString FHttpRetryScheduler::HeaderNamespace = TEXT("");
 FString FHttpRetryScheduler::HeaderSDKVersion = TEXT("");
 FString FHttpRetryScheduler::HeaderOSSVersion = TEXT("");
 FString FHttpRetryScheduler::HeaderGameClientVersion = TEXT("");
 
-TMap<EHttpResponseCodes::Type, FHttpRetryScheduler::FHttpResponseCodeHandler> FHttpRetryScheduler::ResponseCodeDelegates{};
+FHttpRetryScheduler::FHttpResponseCodeHandlersRef FHttpRetryScheduler::ResponseCodeHandlers = MakeShared<FHttpRetryScheduler::FHttpResponseCodeHandlerMap, ESPMode::ThreadSafe>();
+uint32 FHttpRetryScheduler::ResponseCodeHandlersVersion = 0;
 
 typedef FHttpRetryScheduler::FBearerAuthRejectedRefresh FBearerAuthRejectedRefresh;
 
+namespace
+{
+	const FString RouteParameterPlaceholder = TEXT("{id}");
+
+	/**
+	 * Identifier path segments, e.g. user id, item id or numeric offset, are replaced in the route
+	 * so that requests to the same endpoint share a single rate limit bucket.
+	 */
+	bool IsRouteParameterSegment(const FStringView& Segment)
+	{
+		bool bIsNumeric = true;
+		bool bHasDigit = false;
+		for (int32 Index = 0; Index < Segment.Len(); Index++)
+		{
+			const TCHAR Char = Segment[Index];
+			if (FChar::IsDigit(Char))
+			{
+				bHasDigit = true;
+			}
+			else if (FChar::IsAlpha(Char) || Char == TCHAR('-') || Char == TCHAR('_'))
+			{
+				bIsNumeric = false;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		return bIsNumeric || (bHasDigit && Segment.Len() >= 16);
+	}
+}
+
 FHttpRetryScheduler::FHttpRetryScheduler()
 	: TaskQueue()
+	, TaskWakeUpQueue(MakeShared<FTaskWakeUpQueue, ESPMode::ThreadSafe>())
 {
+	const TSharedRef<FRequestAttemptDelegates, ESPMode::ThreadSafe> AttemptDelegates = MakeShared<FRequestAttemptDelegates, ESPMode::ThreadSafe>();
+	AttemptDelegates->OnAttemptCompleted.BindRaw(this, &FHttpRetryScheduler::RecordRequestAttempt);
+	AttemptDelegates->OnRetryRequested.BindRaw(this, &FHttpRetryScheduler::TryRetryRequest);
+	AttemptDelegates->OnThrottled.BindRaw(this, &FHttpRetryScheduler::ThrottleRoute);
+	RequestAttemptDelegates = AttemptDelegates;
+
 	GConfig->GetInt(TEXT("HTTP"), TEXT("RateLimit"), RateLimit, GEngineIni);
+	GConfig->GetInt(TEXT("HTTP"), TEXT("RateLimitMaxPendingRequests"), RateLimitMaxPendingRequests, GEngineIni);
+	GConfig->GetDouble(TEXT("HTTP"), TEXT("RateLimitBucketIdleTimeout"), RateLimitBucketIdleTimeout, GEngineIni);
+	GConfig->GetBool(TEXT("HTTP"), TEXT("EnableRequestCoalescing"), bRequestCoalescingEnabled, GEngineIni);
+	GConfig->GetInt(TEXT("HTTP"), TEXT("CriticalMaxDispatchedRequests"), MaxDispatchedRequests[static_cast<int32>(EAccelByteHttpRequestPriority::Critical)], GEngineIni);
+	GConfig->GetInt(TEXT("HTTP"), TEXT("InteractiveMaxDispatchedRequests"), MaxDispatchedRequests[static_cast<int32>(EAccelByteHttpRequestPriority::Interactive)], GEngineIni);
+	GConfig->GetInt(TEXT("HTTP"), TEXT("BackgroundMaxDispatchedRequests"), MaxDispatchedRequests[static_cast<int32>(EAccelByteHttpRequestPriority::Background)], GEngineIni);
+	GConfig->GetDouble(TEXT("HTTP"), TEXT("RetryBudgetRatio"), RetryBudgetRatio, GEngineIni);
+	GConfig->GetInt(TEXT("HTTP"), TEXT("RetryBudgetMinRetries"), RetryBudgetMinRetries, GEngineIni);
+	GConfig->GetDouble(TEXT("HTTP"), TEXT("RetryBudgetWindow"), RetryBudgetWindow, GEngineIni);
+	GConfig->GetBool(TEXT("HTTP"), TEXT("EnableCircuitBreaker"), bCircuitBreakerEnabled, GEngineIni);
+	GConfig->GetDouble(TEXT("HTTP"), TEXT("CircuitBreakerFailureRate"), CircuitBreakerFailureRate, GEngineIni);
+	GConfig->GetInt(TEXT("HTTP"), TEXT("CircuitBreakerMinRequests"), CircuitBreakerMinRequests, GEngineIni);
+	GConfig->GetDouble(TEXT("HTTP"), TEXT("CircuitBreakerWindow"), CircuitBreakerWindow, GEngineIni);
+	GConfig->GetDouble(TEXT("HTTP"), TEXT("CircuitBreakerOpenDuration"), CircuitBreakerOpenDuration, GEngineIni);
+
+	bool bAsyncResponseDecoding = FHttpResponseDecoder::IsAsyncDecodingEnabled();
+	GConfig->GetBool(TEXT("HTTP"), TEXT("EnableAsyncResponseDecoding"), bAsyncResponseDecoding, GEngineIni);
+	FHttpResponseDecoder::SetAsyncDecodingEnabled(bAsyncResponseDecoding);
+
+	int32 MaxResponseDecodeJobs = FHttpResponseDecoder::GetMaxDecodeJobs();
+	GConfig->GetInt(TEXT("HTTP"), TEXT("MaxResponseDecodeJobs"), MaxResponseDecodeJobs, GEngineIni);
+	FHttpResponseDecoder::SetMaxDecodeJobs(MaxResponseDecodeJobs);
+
+	// e.g. +RouteRateLimits=(Route="/iam/v3/oauth/token",RateLimit=2)
+	TArray<FString> RouteRateLimitEntries;
+	GConfig->GetArray(TEXT("HTTP"), TEXT("RouteRateLimits"), RouteRateLimitEntries, GEngineIni);
+	for (const FString& Entry : RouteRateLimitEntries)
+	{
+		FString Route;
+		int32 RouteRateLimit = 0;
+		if (FParse::Value(*Entry, TEXT("Route="), Route)
+			&& FParse::Value(*Entry, TEXT("RateLimit="), RouteRateLimit)
+			&& !Route.IsEmpty()
+			&& RouteRateLimit > 0)
+		{
+			RouteRateLimits.Emplace(Route, RouteRateLimit);
+		}
+		else
+		{
+			UE_LOG(LogAccelByteHttpRetry, Warning, TEXT("Invalid RouteRateLimits entry %s"), *Entry);
+		}
+	}
 }
 
 FHttpRetryScheduler::~FHttpRetryScheduler()
 {
 	TaskQueue.Empty();
+	TaskHeap.Empty();
+	TaskWakeUpQueue->Empty();
 	RequestsBucket.Empty();
+	PendingRequests.Empty();
+	InFlightRequests.Empty();
+	CircuitBreakers.Empty();
 }
 
 FAccelByteTaskPtr FHttpRetryScheduler::ProcessRequest
 	( FHttpRequestPtr Request
 	, FHttpRequestCompleteDelegate const& CompleteDelegate
-	, double RequestTime )
+	, double RequestTime
+	, EAccelByteHttpRequestPriority Priority
+	, FHttpRequestPolicy const& Policy )
 {
+	SCOPE_CYCLE_COUNTER(STAT_AccelByteHttpProcessRequest);
+
 	FAccelByteTaskPtr Task(nullptr);
 	if (State == EState::ShuttingDown)
 	{
@@ -59,26 +169,74 @@ FAccelByteTaskPtr FHttpRetryScheduler::ProcessRequest
 		return Task;
 	}
 
+	//Http header
+	Request->SetHeader("Namespace", HeaderNamespace);
+	Request->SetHeader("Game-Client-Version", HeaderGameClientVersion);
+	Request->SetHeader("AccelByte-SDK-Version", HeaderSDKVersion);
+	Request->SetHeader("AccelByte-OSS-Version", HeaderOSSVersion);
+
+	// Every caller of a coalescable request gets its own handle, so cancelling one doesn't cancel the others
+	const FString CoalescingKey = bRequestCoalescingEnabled ? GetCoalescingKey(Request) : FString();
+	if (!CoalescingKey.IsEmpty())
+	{
+		if (const FAccelByteTaskWeakPtr* InFlightTaskWeak = InFlightRequests.Find(CoalescingKey))
+		{
+			const FAccelByteTaskPtr InFlightTask = InFlightTaskWeak->Pin();
+			if (InFlightTask.IsValid())
+			{
+				FAccelByteHttpRetryTaskPtr InFlightHttpRetryTask(StaticCastSharedPtr< FHttpRetryTask >(InFlightTask));
+				if (!InFlightHttpRetryTask->IsScheduleRetired())
+				{
+					UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Request joined the identical in-flight request %s"), *Request->GetURL());
+					const int32 CallerId = InFlightHttpRetryTask->AddCoalescedCompleteDelegate(CompleteDelegate);
+					CoalescedRequestNum++;
+					return MakeShared<FHttpCoalescedTask, ESPMode::ThreadSafe>(InFlightHttpRetryTask, CallerId);
+				}
+			}
+		}
+	}
+
 	FReport::LogHttpRequest(Request);
 
-	FVoidHandler OnBearerAuthReject = FVoidHandler::CreateLambda([&]() {BearerAuthRejected(); });
+	FVoidHandler OnBearerAuthReject = FVoidHandler::CreateRaw(this, &FHttpRetryScheduler::BearerAuthRejected);
+
+	const FHttpRequestPolicy ResolvedPolicy = ResolveRequestPolicy(Policy);
 
 	Task = MakeShared<FHttpRetryTask, ESPMode::ThreadSafe>
 		( Request
-		, CompleteDelegate
+		, CoalescingKey.IsEmpty() ? CompleteDelegate : FHttpRequestCompleteDelegate()
 		, RequestTime
-		, InitialDelay
+		, ResolvedPolicy.InitialDelay
 		, OnBearerAuthReject
 		, BearerAuthRejectedRefresh
-		, FHttpRetryScheduler::ResponseCodeDelegates );
+		, FHttpRetryScheduler::ResponseCodeHandlers
+		, ResolvedPolicy );
 
 	FAccelByteHttpRetryTaskPtr HttpRetryTaskPtr(StaticCastSharedPtr< FHttpRetryTask >(Task));
+	HttpRetryTaskPtr->SetPriority(Priority);
 
-	//Http header
-	Request->SetHeader("Namespace", HeaderNamespace);
-	Request->SetHeader("Game-Client-Version", HeaderGameClientVersion);
-	Request->SetHeader("AccelByte-SDK-Version", HeaderSDKVersion);
-	Request->SetHeader("AccelByte-OSS-Version", HeaderOSSVersion);
+	FAccelByteTaskPtr CallerTask = Task;
+	if (!CoalescingKey.IsEmpty())
+	{
+		const int32 CallerId = HttpRetryTaskPtr->AddCoalescedCompleteDelegate(CompleteDelegate);
+		CallerTask = MakeShared<FHttpCoalescedTask, ESPMode::ThreadSafe>(HttpRetryTaskPtr, CallerId);
+	}
+
+	TWeakPtr<FTaskWakeUpQueue, ESPMode::ThreadSafe> WakeUpQueueWeak = TaskWakeUpQueue;
+	FAccelByteTaskWeakPtr TaskWeak = Task;
+	HttpRetryTaskPtr->SetWakeUpDelegate(FSimpleDelegate::CreateLambda([WakeUpQueueWeak, TaskWeak]()
+		{
+			const TSharedPtr<FTaskWakeUpQueue, ESPMode::ThreadSafe> WakeUpQueue = WakeUpQueueWeak.Pin();
+			if (WakeUpQueue.IsValid())
+			{
+				WakeUpQueue->Enqueue(TaskWeak);
+			}
+		}));
+
+	// Computed once for the task, also for a task created paused, it is sent through the same route once resumed
+	HttpRetryTaskPtr->SetRoute(GetRequestRoute(Request->GetURL()));
+	HttpRetryTaskPtr->SetAttemptDelegates(RequestAttemptDelegates);
+	const FString& Route = HttpRetryTaskPtr->GetRoute();
 
 	if (State == EState::Paused && Request->GetHeader("Authorization").Contains("Bearer"))
 	{
@@ -87,40 +245,110 @@ FAccelByteTaskPtr FHttpRetryScheduler::ProcessRequest
 	else
 	{
 		FHttpResponsePtr CachedResponse;
-		if (UAccelByteBlueprintsSettings::IsHttpCacheEnabled() && HttpCache.TryRetrieving(Request, CachedResponse))
+		bool bShouldRevalidate = false;
+		if (UAccelByteBlueprintsSettings::IsHttpCacheEnabled() && HttpCache.TryRetrieving(Request, CachedResponse, bShouldRevalidate))
 		{
 			HttpRetryTaskPtr->FinishFromCached(CachedResponse);
+			if (bShouldRevalidate)
+			{
+				RevalidateCachedResponse(HttpRetryTaskPtr->GetHttpRequest(), RequestTime);
+			}
+
+			// Already finished, the poll must not store or deliver it again
+			return CallerTask.ToSharedRef();
 		}
 		else
 		{
-			int32 AvailableToken = RateLimit;
-			double ResetTokenTime = RequestTime + 1.0f; //Reset every second
-			bool bCancelRequest = false;
-			if (FRequestBucket* LastRequest = RequestsBucket.Find(Request->GetURL()))
+			const TArray<FAccelByteTaskPtr>* RoutePendingRequests = PendingRequests.Find(Route);
+			const int32 PendingRequestNum = RoutePendingRequests != nullptr ? RoutePendingRequests->Num() : 0;
+
+			// Keep the arrival order, a new request can only start right away when nothing is waiting on the route
+			if (!TryPassCircuitBreaker(Route, RequestTime))
+			{
+				UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Circuit breaker is open, request is not sent %s"), *Request->GetURL());
+				Request->SetHeader(GHeaderABRequestNotSentReason, FString::FromInt(static_cast<int32>(ErrorCodes::CircuitBreakerOpen)));
+				HttpRetryTaskPtr->Reject();
+			}
+			else if (PendingRequestNum == 0 && TryConsumeRequestToken(Route, RequestTime))
 			{
-				if (RequestTime < LastRequest->ResetTokenTime)
+				if (!TryDispatchTask(Task))
 				{
-					if (LastRequest->AvailableToken <= 0)
-					{
-						UE_LOG(LogAccelByteHttpRetry, Warning, TEXT("Cannot process request, rate limit reached %s"), *Request->GetURL());
-						Task->Cancel();
-						bCancelRequest = true;
-					}
-					ResetTokenTime = LastRequest->ResetTokenTime;
-					AvailableToken = LastRequest->AvailableToken;
+					DispatchQueues[static_cast<int32>(Priority)].Add(Task);
 				}
 			}
-			if (!bCancelRequest)
+			else if (PendingRequestNum >= RateLimitMaxPendingRequests)
+			{
+				UE_LOG(LogAccelByteHttpRetry, Warning, TEXT("Cannot process request, rate limit reached and pending requests are full %s"), *Request->GetURL());
+				Task->Cancel();
+			}
+			else
 			{
-				Task->Start();
-				RequestsBucket.Emplace(Request->GetURL(), FRequestBucket{ --AvailableToken, ResetTokenTime });
+				UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Rate limit reached, request will be sent later %s"), *Request->GetURL());
+				PendingRequests.FindOrAdd(Route).Add(Task);
 			}
 		}
 
 	}
+
+	if (!CoalescingKey.IsEmpty()
+		&& (Task->State() == EAccelByteTaskState::Running
+			|| Task->State() == EAccelByteTaskState::Pending
+			|| Task->State() == EAccelByteTaskState::Paused))
+	{
+		HttpRetryTaskPtr->SetCoalescingKey(CoalescingKey);
+		InFlightRequests.Emplace(CoalescingKey, Task);
+	}
+
 	TaskQueue.Enqueue(Task);
 
-	return Task.ToSharedRef();
+	return CallerTask.ToSharedRef();
+}
+
+void FHttpRetryScheduler::RevalidateCachedResponse(const FHttpRequestPtr& CachedRequest, double RequestTime)
+{
+	FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
+	Request->SetVerb(CachedRequest->GetVerb());
+	Request->SetURL(CachedRequest->GetURL());
+	for (const FString& HeaderAndValue : CachedRequest->GetAllHeaders())
+	{
+		FString Header, Value;
+		if (HeaderAndValue.Split(TEXT(":"), &Header, &Value))
+		{
+			Request->SetHeader(Header.TrimStartAndEnd(), Value.TrimStartAndEnd());
+		}
+	}
+
+	if (!HttpCache.StartRevalidation(Request))
+	{
+		return;
+	}
+
+	UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Revalidating the stale cached response in background %s"), *Request->GetURL());
+	const FAccelByteTaskPtr Task = ProcessRequest(Request
+		, FHttpRequestCompleteDelegate::CreateRaw(this, &FHttpRetryScheduler::OnRevalidationCompleted)
+		, RequestTime
+		, EAccelByteHttpRequestPriority::Background);
+	if (!Task.IsValid())
+	{
+		HttpCache.FinishRevalidation(Request);
+	}
+}
+
+void FHttpRetryScheduler::OnRevalidationCompleted(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded)
+{
+	// The response was already stored by the poll, only release the key for the next revalidation
+	HttpCache.FinishRevalidation(Request);
+}
+
+FHttpRequestPolicy FHttpRetryScheduler::ResolveRequestPolicy(const FHttpRequestPolicy& Policy)
+{
+	FHttpRequestPolicy Result = Policy;
+	Result.Deadline = Policy.Deadline > 0.0 ? Policy.Deadline : static_cast<double>(TotalTimeout);
+	Result.MaxAttempts = FMath::Max(Policy.MaxAttempts, 0);
+	Result.InitialDelay = Policy.InitialDelay > 0.0 ? Policy.InitialDelay : static_cast<double>(InitialDelay);
+	Result.MaximumDelay = Policy.MaximumDelay > 0.0 ? Policy.MaximumDelay : static_cast<double>(MaximumDelay);
+	Result.BackoffMultiplier = Policy.BackoffMultiplier > 0.0 ? Policy.BackoffMultiplier : 2.0;
+	return Result;
 }
 
 void FHttpRetryScheduler::SetBearerAuthRejectedDelegate(FBearerAuthRejected BearerAuthRejected)
@@ -135,16 +363,24 @@ void FHttpRetryScheduler::SetBearerAuthRejectedDelegate(FBearerAuthRejected Bear
 
 void FHttpRetryScheduler::SetHttpResponseCodeHandlerDelegate(EHttpResponseCodes::Type StatusCode, FHttpResponseCodeHandler const& Handler)
 {
-	FHttpRetryScheduler::ResponseCodeDelegates.Emplace(StatusCode, Handler);
+	TSharedRef<FHttpResponseCodeHandlerMap, ESPMode::ThreadSafe> NewHandlers = MakeShared<FHttpResponseCodeHandlerMap, ESPMode::ThreadSafe>(*ResponseCodeHandlers);
+	NewHandlers->Emplace(StatusCode, Handler);
+
+	ResponseCodeHandlers = NewHandlers;
+	ResponseCodeHandlersVersion++;
 }
 
 bool FHttpRetryScheduler::RemoveHttpResponseCodeHandlerDelegate(EHttpResponseCodes::Type StatusCode)
 {
 	bool bResult = false;
 
-	if (FHttpRetryScheduler::ResponseCodeDelegates.Contains(StatusCode))
+	if (ResponseCodeHandlers->Contains(StatusCode))
 	{
-		FHttpRetryScheduler::ResponseCodeDelegates.Remove(StatusCode);
+		TSharedRef<FHttpResponseCodeHandlerMap, ESPMode::ThreadSafe> NewHandlers = MakeShared<FHttpResponseCodeHandlerMap, ESPMode::ThreadSafe>(*ResponseCodeHandlers);
+		NewHandlers->Remove(StatusCode);
+
+		ResponseCodeHandlers = NewHandlers;
+		ResponseCodeHandlersVersion++;
 		bResult = true;
 	}
 	return bResult;
@@ -163,24 +399,18 @@ void FHttpRetryScheduler::PauseBearerAuthRequest()
 {
 	UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("HTTP Retry Scheduler PAUSED"));
 	State = EState::Paused;
-	TQueue<FAccelByteTaskPtr, EQueueMode::Spsc> TempQueue;
-	
-	while (FAccelByteTaskPtr *TaskPtr = TaskQueue.Peek())
-	{
-		FAccelByteTaskPtr Task = *TaskPtr;
-		
-		TaskQueue.Pop();
-		Task->Pause();
-		TempQueue.Enqueue(Task);
-	}
 
-	while (FAccelByteTaskPtr *TaskPtr = TempQueue.Peek())
+	MoveQueuedTasksToHeap();
+	for (const FScheduledTask& Entry : TaskHeap)
 	{
-		FAccelByteTaskPtr Task = *TaskPtr;
-		
-		TempQueue.Pop();
-		TaskQueue.Enqueue(Task);
+		if (!IsTaskEntryStale(Entry))
+		{
+			Entry.Task->Pause();
+		}
 	}
+
+	// Paused tasks wake up on their pause timeout instead
+	RebuildTaskHeap();
 }
   
 void FHttpRetryScheduler::ResumeBearerAuthRequest(const FString& AccessToken)
@@ -188,8 +418,12 @@ void FHttpRetryScheduler::ResumeBearerAuthRequest(const FString& AccessToken)
 	UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("HTTP Retry Scheduler RESUME"));
 	if (BearerAuthRejectedRefresh.IsBound()) 
 	{
+		MoveQueuedTasksToHeap();
 		BearerAuthRejectedRefresh.Broadcast(AccessToken);
 		BearerAuthRejectedRefresh.Clear();
+
+		RequeueResumedTasks();
+		RebuildTaskHeap();
 	}
 
 	if (State == EState::Paused) 
@@ -198,69 +432,714 @@ void FHttpRetryScheduler::ResumeBearerAuthRequest(const FString& AccessToken)
 	}
 }
 
-bool FHttpRetryScheduler::PollRetry(double Time)
+void FHttpRetryScheduler::RequeueResumedTasks()
 {
-	if (TaskQueue.IsEmpty())
+	TSet<const FAccelByteTask*> QueuedTasks;
+	for (const TPair<FString, TArray<FAccelByteTaskPtr>>& RouteTasks : PendingRequests)
+	{
+		for (const FAccelByteTaskPtr& Task : RouteTasks.Value)
+		{
+			QueuedTasks.Add(Task.Get());
+		}
+	}
+	for (const TArray<FAccelByteTaskPtr>& DispatchQueue : DispatchQueues)
+	{
+		for (const FAccelByteTaskPtr& Task : DispatchQueue)
+		{
+			QueuedTasks.Add(Task.Get());
+		}
+	}
+
+	// A resumed task waits for a token of its route and a dispatch slot, like the requests that were never paused
+	for (const FScheduledTask& Entry : TaskHeap)
+	{
+		if (IsTaskEntryStale(Entry) || Entry.Task->State() != EAccelByteTaskState::Pending || QueuedTasks.Contains(Entry.Task.Get()))
+		{
+			continue;
+		}
+
+		RequeuePendingTask(Entry.Task);
+		QueuedTasks.Add(Entry.Task.Get());
+	}
+}
+
+void FHttpRetryScheduler::RequeuePendingTask(const FAccelByteTaskPtr& Task)
+{
+	FAccelByteHttpRetryTaskPtr HttpRetryTaskPtr(StaticCastSharedPtr< FHttpRetryTask >(Task));
+	if (HttpRetryTaskPtr->IsDispatched())
+	{
+		DispatchedRequestNum[static_cast<int32>(HttpRetryTaskPtr->GetPriority())]--;
+		HttpRetryTaskPtr->SetDispatched(false);
+	}
+
+	PendingRequests.FindOrAdd(HttpRetryTaskPtr->GetRoute()).Add(Task);
+}
+
+void FHttpRetryScheduler::ScheduleTask(const FAccelByteTaskPtr& Task, double Time)
+{
+	FAccelByteHttpRetryTaskPtr HttpRetryTaskPtr(StaticCastSharedPtr< FHttpRetryTask >(Task));
+	TaskHeap.HeapPush(FScheduledTask{ Time, HttpRetryTaskPtr->IncrementScheduleGeneration(), Task });
+}
+
+void FHttpRetryScheduler::MoveQueuedTasksToHeap()
+{
+	FAccelByteTaskPtr Task;
+	while (TaskQueue.Dequeue(Task))
+	{
+		ScheduleTask(Task, Task->Time());
+	}
+}
+
+void FHttpRetryScheduler::RebuildTaskHeap()
+{
+	TaskHeap.RemoveAllSwap([this](const FScheduledTask& Entry) { return IsTaskEntryStale(Entry); }, false);
+
+	for (FScheduledTask& Entry : TaskHeap)
+	{
+		FAccelByteHttpRetryTaskPtr HttpRetryTaskPtr(StaticCastSharedPtr< FHttpRetryTask >(Entry.Task));
+		Entry.Time = HttpRetryTaskPtr->GetNextTickTime();
+	}
+
+	TaskHeap.Heapify();
+}
+
+bool FHttpRetryScheduler::IsTaskEntryStale(const FScheduledTask& Entry) const
+{
+	FAccelByteHttpRetryTaskPtr HttpRetryTaskPtr(StaticCastSharedPtr< FHttpRetryTask >(Entry.Task));
+	return HttpRetryTaskPtr->IsScheduleRetired() || HttpRetryTaskPtr->GetScheduleGeneration() != Entry.Generation;
+}
+
+FString FHttpRetryScheduler::GetRequestRoute(const FString& Url)
+{
+	int32 PathEnd = INDEX_NONE;
+	if (!Url.FindChar(TCHAR('?'), PathEnd))
+	{
+		PathEnd = Url.Len();
+	}
+
+	// The scheme and its separator are kept as they are, only the host and the path are tokenized
+	int32 SegmentStart = Url.Find(TEXT("://"), ESearchCase::CaseSensitive);
+	SegmentStart = SegmentStart != INDEX_NONE && SegmentStart < PathEnd ? SegmentStart + 3 : 0;
+
+	// Built in place in a single buffer, it is computed for every request
+	FString Route;
+	Route.Reserve(PathEnd + RouteParameterPlaceholder.Len());
+	Route.AppendChars(*Url, SegmentStart);
+
+	bool bIsFirstSegment = true;
+	while (SegmentStart < PathEnd)
+	{
+		int32 SegmentEnd = SegmentStart;
+		while (SegmentEnd < PathEnd && Url[SegmentEnd] != TCHAR('/'))
+		{
+			SegmentEnd++;
+		}
+
+		// Empty segments are dropped, e.g. a doubled or a trailing slash
+		if (SegmentEnd > SegmentStart)
+		{
+			if (!bIsFirstSegment)
+			{
+				Route.AppendChar(TCHAR('/'));
+			}
+			bIsFirstSegment = false;
+
+			const FStringView Segment(*Url + SegmentStart, SegmentEnd - SegmentStart);
+			if (IsRouteParameterSegment(Segment))
+			{
+				Route.Append(RouteParameterPlaceholder);
+			}
+			else
+			{
+				Route.AppendChars(Segment.GetData(), Segment.Len());
+			}
+		}
+		SegmentStart = SegmentEnd + 1;
+	}
+
+	return Route;
+}
+
+FString FHttpRetryScheduler::GetCoalescingKey(const FHttpRequestPtr& Request)
+{
+	const FString Verb = Request->GetVerb();
+	if (Verb != TEXT("GET") && Verb != TEXT("HEAD"))
+	{
+		return FString();
+	}
+
+	// The headers that select the representation or the tenant are part of the identity of the response
+	const FString Url = Request->GetURL();
+	const FString Authorization = Request->GetHeader(TEXT("Authorization"));
+	const FString Accept = Request->GetHeader(TEXT("Accept"));
+	const FString Namespace = Request->GetHeader(TEXT("Namespace"));
+
+	FString Key;
+	Key.Reserve(Verb.Len() + Url.Len() + Authorization.Len() + Accept.Len() + Namespace.Len() + 4);
+	for (const FString* Part : { &Verb, &Url, &Authorization, &Accept, &Namespace })
+	{
+		if (!Key.IsEmpty())
+		{
+			Key.AppendChar(TCHAR(' '));
+		}
+		Key.Append(*Part);
+	}
+	return Key;
+}
+
+int32 FHttpRetryScheduler::GetRouteRateLimit(const FString& Route) const
+{
+	int32 Result = RateLimit;
+	int32 MatchLength = 0;
+	for (const TPair<FString, int32>& RouteRateLimit : RouteRateLimits)
+	{
+		if (RouteRateLimit.Key.Len() > MatchLength && Route.Contains(RouteRateLimit.Key))
+		{
+			Result = RouteRateLimit.Value;
+			MatchLength = RouteRateLimit.Key.Len();
+		}
+	}
+	return Result;
+}
+
+bool FHttpRetryScheduler::TryConsumeRequestToken(const FString& Route, double Time)
+{
+	FRequestBucket* Bucket = RequestsBucket.Find(Route);
+	if (Bucket == nullptr)
+	{
+		Bucket = &RequestsBucket.Add(Route, FRequestBucket{ 0, 0.0, GetRouteRateLimit(Route), Time });
+	}
+
+	Bucket->LastAccessTime = Time;
+
+	if (Time < Bucket->ThrottledUntilTime)
 	{
 		return false;
 	}
 
-	TArray<FAccelByteTaskPtr> RemovedTasks;
-	bool Loop = true;
-	do
+	if (Time >= Bucket->ResetTokenTime)
+	{
+		Bucket->AvailableToken = Bucket->TokenLimit;
+		Bucket->ResetTokenTime = Time + 1.0f; //Reset every second
+	}
+
+	if (Bucket->AvailableToken <= 0)
 	{
-		FAccelByteTaskPtr *TaskPtr = TaskQueue.Peek();
-		if (TaskPtr != nullptr)
+		return false;
+	}
+
+	Bucket->AvailableToken--;
+	return true;
+}
+
+void FHttpRetryScheduler::AdmitPendingRequests(double Time)
+{
+	for (auto It = PendingRequests.CreateIterator(); It; ++It)
+	{
+		TArray<FAccelByteTaskPtr>& Tasks = It.Value();
+
+		int32 DequeuedNum = 0;
+		for (; DequeuedNum < Tasks.Num(); DequeuedNum++)
 		{
-			FAccelByteTaskPtr Task = *TaskPtr;
+			const FAccelByteTaskPtr& Task = Tasks[DequeuedNum];
 
-			if (Task->Time() < Time)
+			// Skip the request that has been paused, cancelled or timed out while waiting
+			if (Task->State() != EAccelByteTaskState::Pending || TryRejectByCircuitBreaker(Task, Time))
 			{
-				TaskQueue.Pop();
+				continue;
+			}
 
-				bool WillBeRemoved = false;
-				Task->Tick(Time);
+			if (!TryConsumeRequestToken(It.Key(), Time))
+			{
+				break;
+			}
 
-				switch (Task->State())
-				{
-				case EAccelByteTaskState::Completed:
-				case EAccelByteTaskState::Cancelled:
-				case EAccelByteTaskState::Failed:
-					RemovedTasks.Add(Task);
-					WillBeRemoved = true;
-					break;
-				default:
-					break;
-				}
+			DispatchOrQueueTask(Task, Time);
+		}
 
-				if (!WillBeRemoved)
-				{
-					TaskQueue.Enqueue(Task);
-				}
+		Tasks.RemoveAt(0, DequeuedNum, false);
+		if (Tasks.Num() == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+bool FHttpRetryScheduler::TryDispatchTask(const FAccelByteTaskPtr& Task)
+{
+	FAccelByteHttpRetryTaskPtr HttpRetryTaskPtr(StaticCastSharedPtr< FHttpRetryTask >(Task));
+	const int32 PriorityIndex = static_cast<int32>(HttpRetryTaskPtr->GetPriority());
+
+	const int32 MaxRequests = MaxDispatchedRequests[PriorityIndex];
+	if (MaxRequests > 0 && DispatchedRequestNum[PriorityIndex] >= MaxRequests)
+	{
+		return false;
+	}
+
+	DispatchedRequestNum[PriorityIndex]++;
+	HttpRetryTaskPtr->SetDispatched(true);
+	Task->Start();
+
+	return true;
+}
+
+void FHttpRetryScheduler::DispatchOrQueueTask(const FAccelByteTaskPtr& Task, double Time)
+{
+	if (TryDispatchTask(Task))
+	{
+		ScheduleTask(Task, Time);
+	}
+	else
+	{
+		FAccelByteHttpRetryTaskPtr HttpRetryTaskPtr(StaticCastSharedPtr< FHttpRetryTask >(Task));
+		DispatchQueues[static_cast<int32>(HttpRetryTaskPtr->GetPriority())].Add(Task);
+	}
+}
+
+void FHttpRetryScheduler::DispatchQueuedRequests(double Time)
+{
+	// Higher priority class first
+	for (TArray<FAccelByteTaskPtr>& DispatchQueue : DispatchQueues)
+	{
+		int32 DequeuedNum = 0;
+		for (; DequeuedNum < DispatchQueue.Num(); DequeuedNum++)
+		{
+			const FAccelByteTaskPtr& Task = DispatchQueue[DequeuedNum];
+
+			// Skip the request that has been paused, cancelled or timed out while waiting
+			if (Task->State() != EAccelByteTaskState::Pending || TryRejectByCircuitBreaker(Task, Time))
+			{
+				continue;
 			}
-			else
+
+			if (!TryDispatchTask(Task))
 			{
-				Loop = false;
+				break;
 			}
+
+			ScheduleTask(Task, Time);
 		}
-		else
+
+		DispatchQueue.RemoveAt(0, DequeuedNum, false);
+	}
+}
+
+void FHttpRetryScheduler::SetMaxDispatchedRequests(EAccelByteHttpRequestPriority Priority, int32 MaxRequests)
+{
+	if (Priority < EAccelByteHttpRequestPriority::Num)
+	{
+		MaxDispatchedRequests[static_cast<int32>(Priority)] = FMath::Max(MaxRequests, 0);
+	}
+}
+
+int32 FHttpRetryScheduler::GetMaxDispatchedRequests(EAccelByteHttpRequestPriority Priority)
+{
+	return Priority < EAccelByteHttpRequestPriority::Num ? MaxDispatchedRequests[static_cast<int32>(Priority)] : 0;
+}
+
+int32 FHttpRetryScheduler::GetDispatchedRequestNum(EAccelByteHttpRequestPriority Priority) const
+{
+	return Priority < EAccelByteHttpRequestPriority::Num ? DispatchedRequestNum[static_cast<int32>(Priority)] : 0;
+}
+
+int32 FHttpRetryScheduler::GetQueuedRequestNum(EAccelByteHttpRequestPriority Priority) const
+{
+	return Priority < EAccelByteHttpRequestPriority::Num ? DispatchQueues[static_cast<int32>(Priority)].Num() : 0;
+}
+
+EAccelByteCircuitBreakerState FHttpRetryScheduler::GetCircuitBreakerState(const FString& Url) const
+{
+	const FCircuitBreaker* CircuitBreaker = CircuitBreakers.Find(GetRequestRoute(Url));
+	return CircuitBreaker != nullptr ? CircuitBreaker->State : EAccelByteCircuitBreakerState::Closed;
+}
+
+bool FHttpRetryScheduler::TryPassCircuitBreaker(const FString& Route, double Time)
+{
+	FCircuitBreaker* CircuitBreaker = bCircuitBreakerEnabled ? CircuitBreakers.Find(Route) : nullptr;
+	switch (CircuitBreaker != nullptr ? CircuitBreaker->State : EAccelByteCircuitBreakerState::Closed)
+	{
+	case EAccelByteCircuitBreakerState::Open:
+		if (Time - CircuitBreaker->OpenTime < CircuitBreakerOpenDuration)
+		{
+			return false;
+		}
+		SetCircuitBreakerState(Route, *CircuitBreaker, EAccelByteCircuitBreakerState::HalfOpen, Time);
+		CircuitBreaker->ProbeTime = Time;
+		break;
+	case EAccelByteCircuitBreakerState::HalfOpen:
+		// Only a single probe at a time, another one is let through if the probe never reported back
+		if (CircuitBreaker->ProbeTime > 0.0 && Time - CircuitBreaker->ProbeTime < TotalTimeout)
+		{
+			return false;
+		}
+		CircuitBreaker->ProbeTime = Time;
+		break;
+	default:
+		break;
+	}
+
+	UpdateRetryBudgetWindow(Time);
+	RetryBudgetRequestNum++;
+	return true;
+}
+
+bool FHttpRetryScheduler::TryRejectByCircuitBreaker(const FAccelByteTaskPtr& Task, double Time)
+{
+	if (!bCircuitBreakerEnabled)
+	{
+		return false;
+	}
+
+	// A request queued before the breaker opened must fail fast as well, the probe is left to the new requests
+	FAccelByteHttpRetryTaskPtr HttpRetryTaskPtr(StaticCastSharedPtr< FHttpRetryTask >(Task));
+	const FHttpRequestPtr Request = HttpRetryTaskPtr->GetHttpRequest();
+	const FCircuitBreaker* CircuitBreaker = CircuitBreakers.Find(HttpRetryTaskPtr->GetRoute());
+	if (CircuitBreaker == nullptr
+		|| CircuitBreaker->State != EAccelByteCircuitBreakerState::Open
+		|| Time - CircuitBreaker->OpenTime >= CircuitBreakerOpenDuration)
+	{
+		return false;
+	}
+
+	UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Circuit breaker is open, queued request is not sent %s"), *Request->GetURL());
+	Request->SetHeader(GHeaderABRequestNotSentReason, FString::FromInt(static_cast<int32>(ErrorCodes::CircuitBreakerOpen)));
+	HttpRetryTaskPtr->Reject();
+
+	// Finished on the next poll instead of its deadline
+	ScheduleTask(Task, Time);
+	return true;
+}
+
+void FHttpRetryScheduler::SetCircuitBreakerState(const FString& Route, FCircuitBreaker& CircuitBreaker, EAccelByteCircuitBreakerState NewState, double Time)
+{
+	if (CircuitBreaker.State == NewState)
+	{
+		return;
+	}
+
+	CircuitBreaker.State = NewState;
+	CircuitBreaker.RequestNum = 0;
+	CircuitBreaker.FailureNum = 0;
+	CircuitBreaker.WindowStartTime = Time;
+	CircuitBreaker.ProbeTime = 0.0;
+
+	switch (NewState)
+	{
+	case EAccelByteCircuitBreakerState::Open:
+		UE_LOG(LogAccelByteHttpRetry, Warning, TEXT("Circuit breaker OPENED, requests fail fast for %.1f seconds %s"), CircuitBreakerOpenDuration, *Route);
+		CircuitBreaker.OpenTime = Time;
+		break;
+	case EAccelByteCircuitBreakerState::HalfOpen:
+		UE_LOG(LogAccelByteHttpRetry, Log, TEXT("Circuit breaker HALF-OPENED, sending a probe request %s"), *Route);
+		break;
+	default:
+		UE_LOG(LogAccelByteHttpRetry, Log, TEXT("Circuit breaker CLOSED %s"), *Route);
+		break;
+	}
+
+	CircuitBreakerStateChanged.Broadcast(Route, NewState);
+}
+
+void FHttpRetryScheduler::RecordRequestAttempt(const FString& Route, double Time, bool bIsFailed)
+{
+	if (!bCircuitBreakerEnabled)
+	{
+		return;
+	}
+
+	FCircuitBreaker* CircuitBreaker = CircuitBreakers.Find(Route);
+	if (CircuitBreaker == nullptr)
+	{
+		if (!bIsFailed)
+		{
+			return;
+		}
+		CircuitBreaker = &CircuitBreakers.Add(Route, FCircuitBreaker{ EAccelByteCircuitBreakerState::Closed, 0, 0, Time });
+	}
+
+	switch (CircuitBreaker->State)
+	{
+	case EAccelByteCircuitBreakerState::Closed:
+		if (Time - CircuitBreaker->WindowStartTime > CircuitBreakerWindow)
+		{
+			CircuitBreaker->RequestNum = 0;
+			CircuitBreaker->FailureNum = 0;
+			CircuitBreaker->WindowStartTime = Time;
+		}
+
+		CircuitBreaker->RequestNum++;
+		if (bIsFailed)
+		{
+			CircuitBreaker->FailureNum++;
+		}
+
+		if (CircuitBreaker->RequestNum >= CircuitBreakerMinRequests
+			&& CircuitBreaker->FailureNum >= CircuitBreaker->RequestNum * CircuitBreakerFailureRate)
+		{
+			SetCircuitBreakerState(Route, *CircuitBreaker, EAccelByteCircuitBreakerState::Open, Time);
+		}
+		break;
+	case EAccelByteCircuitBreakerState::HalfOpen:
+		SetCircuitBreakerState(Route, *CircuitBreaker
+			, bIsFailed ? EAccelByteCircuitBreakerState::Open : EAccelByteCircuitBreakerState::Closed
+			, Time);
+		break;
+	default:
+		// Late results of the requests sent before the breaker opened
+		break;
+	}
+}
+
+bool FHttpRetryScheduler::TryRetryRequest(const FString& Route, double Time)
+{
+	const FCircuitBreaker* CircuitBreaker = bCircuitBreakerEnabled ? CircuitBreakers.Find(Route) : nullptr;
+	if (CircuitBreaker != nullptr && CircuitBreaker->State != EAccelByteCircuitBreakerState::Closed)
+	{
+		UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Circuit breaker is not closed, request will not be retried %s"), *Route);
+		RejectedRetryNum++;
+		return false;
+	}
+
+	if (RetryBudgetRatio <= 0.0)
+	{
+		return true;
+	}
+
+	UpdateRetryBudgetWindow(Time);
+	const int32 MaxRetryNum = FMath::Max(RetryBudgetMinRetries, FMath::FloorToInt(RetryBudgetRequestNum * RetryBudgetRatio));
+	if (RetryBudgetRetryNum >= MaxRetryNum)
+	{
+		UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Retry budget exhausted, request will not be retried %s"), *Route);
+		RejectedRetryNum++;
+		return false;
+	}
+
+	RetryBudgetRetryNum++;
+	return true;
+}
+
+void FHttpRetryScheduler::ThrottleRoute(const FString& Route, double ThrottledUntilTime)
+{
+	FRequestBucket* Bucket = RequestsBucket.Find(Route);
+	if (Bucket == nullptr)
+	{
+		Bucket = &RequestsBucket.Add(Route, FRequestBucket{ 0, 0.0, GetRouteRateLimit(Route), 0.0 });
+	}
+
+	if (ThrottledUntilTime > Bucket->ThrottledUntilTime)
+	{
+		UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Server asked to back off for %.1f seconds %s"), ThrottledUntilTime - FPlatformTime::Seconds(), *Route);
+		Bucket->ThrottledUntilTime = ThrottledUntilTime;
+
+		// Start again from a fresh token set once the throttle is lifted
+		Bucket->AvailableToken = 0;
+		Bucket->ResetTokenTime = ThrottledUntilTime;
+	}
+}
+
+bool FHttpRetryScheduler::GetServerRetryDelay(const FHttpResponsePtr& Response, double& OutDelay)
+{
+	if (!Response.IsValid())
+	{
+		return false;
+	}
+
+	const int32 ResponseCode = Response->GetResponseCode();
+	if (ResponseCode == EHttpResponseCodes::TooManyRequests || ResponseCode == EHttpResponseCodes::ServiceUnavail)
+	{
+		const FString RetryAfter = Response->GetHeader(TEXT("Retry-After")).TrimStartAndEnd();
+		if (!RetryAfter.IsEmpty())
 		{
-			Loop = false;
+			FDateTime RetryDate;
+			if (RetryAfter.IsNumeric())
+			{
+				OutDelay = FMath::Max(FCString::Atod(*RetryAfter), 0.0);
+				return true;
+			}
+			else if (FDateTime::ParseHttpDate(RetryAfter, RetryDate))
+			{
+				OutDelay = FMath::Max((RetryDate - FDateTime::UtcNow()).GetTotalSeconds(), 0.0);
+				return true;
+			}
 		}
-	} while (Loop);
+	}
+
+	for (const TCHAR* HeaderPrefix : { TEXT("RateLimit-"), TEXT("X-RateLimit-") })
+	{
+		const FString Remaining = Response->GetHeader(FString(HeaderPrefix) + TEXT("Remaining")).TrimStartAndEnd();
+		const FString Reset = Response->GetHeader(FString(HeaderPrefix) + TEXT("Reset")).TrimStartAndEnd();
+		if (Remaining.IsNumeric() && FCString::Atoi(*Remaining) <= 0 && Reset.IsNumeric())
+		{
+			double ResetDelay = FCString::Atod(*Reset);
+
+			// Some services send the reset as a unix timestamp instead of a delay
+			if (ResetDelay > 1000000000.0)
+			{
+				ResetDelay -= FDateTime::UtcNow().ToUnixTimestamp();
+			}
+
+			OutDelay = FMath::Max(ResetDelay, 0.0);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FHttpRetryScheduler::UpdateRetryBudgetWindow(double Time)
+{
+	if (Time - RetryBudgetWindowStartTime > RetryBudgetWindow)
+	{
+		RetryBudgetRequestNum = 0;
+		RetryBudgetRetryNum = 0;
+		RetryBudgetWindowStartTime = Time;
+	}
+}
+
+void FHttpRetryScheduler::EvictIdleRequestsBuckets(double Time)
+{
+	for (auto It = RequestsBucket.CreateIterator(); It; ++It)
+	{
+		if (Time - It.Value().LastAccessTime > RateLimitBucketIdleTimeout
+			&& Time >= It.Value().ThrottledUntilTime
+			&& !PendingRequests.Contains(It.Key()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (auto It = CircuitBreakers.CreateIterator(); It; ++It)
+	{
+		if (It.Value().State == EAccelByteCircuitBreakerState::Closed
+			&& Time - It.Value().WindowStartTime > RateLimitBucketIdleTimeout)
+		{
+			It.RemoveCurrent();
+		}
+	}
+	LastRequestsBucketEvictionTime = Time;
+}
+
+bool FHttpRetryScheduler::PollRetry(double Time)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AccelByteHttpPollRetry);
+
+	MoveQueuedTasksToHeap();
+
+	FAccelByteTaskWeakPtr WokenTaskWeak;
+	while (TaskWakeUpQueue->Dequeue(WokenTaskWeak))
+	{
+		const FAccelByteTaskPtr WokenTask = WokenTaskWeak.Pin();
+		if (!WokenTask.IsValid())
+		{
+			continue;
+		}
+
+		FAccelByteHttpRetryTaskPtr HttpRetryTaskPtr(StaticCastSharedPtr< FHttpRetryTask >(WokenTask));
+		if (!HttpRetryTaskPtr->IsScheduleRetired())
+		{
+			ScheduleTask(WokenTask, Time);
+		}
+	}
+
+	if (PendingRequests.Num() > 0)
+	{
+		AdmitPendingRequests(Time);
+	}
+
+	if (Time - LastRequestsBucketEvictionTime > RateLimitBucketIdleTimeout)
+	{
+		EvictIdleRequestsBuckets(Time);
+	}
+
+	if (TaskHeap.Num() == 0)
+	{
+		return false;
+	}
+
+	// Only the due tasks are ticked, each of them at most once per poll
+	TArray<FAccelByteTaskPtr> RemovedTasks;
+	TArray<FAccelByteTaskPtr> TickedTasks;
+	while (TaskHeap.Num() > 0 && TaskHeap.HeapTop().Time <= Time)
+	{
+		FScheduledTask Entry;
+		TaskHeap.HeapPop(Entry, false);
+
+		if (IsTaskEntryStale(Entry))
+		{
+			continue;
+		}
+
+		FAccelByteTaskPtr Task = Entry.Task;
+		const EAccelByteTaskState PreviousState = Task->State();
+		Task->Tick(Time);
+
+		// A retry of a throttled route waits for a token behind the other requests of the route
+		if (PreviousState == EAccelByteTaskState::Retrying && Task->State() == EAccelByteTaskState::Pending)
+		{
+			RequeuePendingTask(Task);
+		}
+
+		switch (Task->State())
+		{
+		case EAccelByteTaskState::Completed:
+		case EAccelByteTaskState::Cancelled:
+		case EAccelByteTaskState::Failed:
+			StaticCastSharedPtr< FHttpRetryTask >(Task)->RetireSchedule();
+			RemovedTasks.Add(Task);
+			break;
+		default:
+			TickedTasks.Add(Task);
+			break;
+		}
+	}
+
+	for (const FAccelByteTaskPtr& Task : TickedTasks)
+	{
+		FAccelByteHttpRetryTaskPtr HttpRetryTaskPtr(StaticCastSharedPtr< FHttpRetryTask >(Task));
+		ScheduleTask(Task, HttpRetryTaskPtr->GetNextTickTime());
+	}
 
 	const bool bIsHttpCacheEnabled = UAccelByteBlueprintsSettings::IsHttpCacheEnabled();
 	for (auto& Task : RemovedTasks)
 	{
+		FAccelByteHttpRetryTaskPtr RemovedHttpRetryTask(StaticCastSharedPtr< FHttpRetryTask >(Task));
+		if (RemovedHttpRetryTask->IsDispatched())
+		{
+			DispatchedRequestNum[static_cast<int32>(RemovedHttpRetryTask->GetPriority())]--;
+			RemovedHttpRetryTask->SetDispatched(false);
+		}
+
+		const FString& CoalescingKey = RemovedHttpRetryTask->GetCoalescingKey();
+		if (!CoalescingKey.IsEmpty())
+		{
+			const FAccelByteTaskWeakPtr* InFlightTaskWeak = InFlightRequests.Find(CoalescingKey);
+			if (InFlightTaskWeak != nullptr && InFlightTaskWeak->Pin() == Task)
+			{
+				InFlightRequests.Remove(CoalescingKey);
+			}
+		}
+
 		if (bIsHttpCacheEnabled && Task->State() == EAccelByteTaskState::Completed)
 		{
 			FAccelByteHttpRetryTaskPtr HttpRetryTaskPtr(StaticCastSharedPtr< FHttpRetryTask >(Task));
 			HttpCache.TryStoring(HttpRetryTaskPtr->GetHttpRequest());
 		}
-		
+
+		// A 304, or a failure within the stale-if-error window, is answered with the cached response
+		FHttpResponsePtr CachedResponse;
+		if (bIsHttpCacheEnabled
+			&& (Task->State() == EAccelByteTaskState::Completed || Task->State() == EAccelByteTaskState::Failed)
+			&& HttpCache.TryRetrievingFallback(RemovedHttpRetryTask->GetHttpRequest(), CachedResponse))
+		{
+			RemovedHttpRetryTask->FinishFromCached(CachedResponse);
+			continue;
+		}
+
 		Task->Finish();
 	}
 
+	DispatchQueuedRequests(Time);
+
 	return true;
 }
 
@@ -278,7 +1157,7 @@ void FHttpRetryScheduler::Startup()
 	State = EState::Initialized;
 	UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("HTTP Retry Scheduler has been INITIALIZED"));
 
-	HttpCache.ClearCache();
+	HttpCache.ClearCache(false);
 }
 
 void FHttpRetryScheduler::Shutdown()
@@ -296,7 +1175,7 @@ void FHttpRetryScheduler::Shutdown()
 	}
 
 	// flush http requests
-	if (!TaskQueue.IsEmpty())
+	if (!TaskQueue.IsEmpty() || TaskHeap.Num() > 0)
 	{
 		double MaxFlushTimeSeconds = -1.0;
 		GConfig->GetDouble(TEXT("HTTP"), TEXT("MaxFlushTimeSeconds"), MaxFlushTimeSeconds, GEngineIni);
@@ -316,6 +1195,15 @@ void FHttpRetryScheduler::Shutdown()
 
 		// cancel unfinished http requests, so don't hinder the shutdown
 		TaskQueue.Empty();
+		TaskHeap.Empty();
+		TaskWakeUpQueue->Empty();
+		PendingRequests.Empty();
+		InFlightRequests.Empty();
+		for (int32 PriorityIndex = 0; PriorityIndex < PriorityNum; PriorityIndex++)
+		{
+			DispatchQueues[PriorityIndex].Empty();
+			DispatchedRequestNum[PriorityIndex] = 0;
+		}
 	}
 }
 
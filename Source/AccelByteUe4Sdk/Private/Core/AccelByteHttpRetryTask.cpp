@@ -14,7 +14,8 @@ namespace AccelByte
 		double InNextDelay,
 		const FVoidHandler& InOnBearerAuthRejectDelegate,
 		FBearerAuthRejectedRefresh& InBearerAuthRejectedRefresh,
-		TMap<EHttpResponseCodes::Type, FHttpRetryScheduler::FHttpResponseCodeHandler> HandlerDelegates)
+		const FHttpRetryScheduler::FHttpResponseCodeHandlersRef& InResponseCodeHandlers,
+		const FHttpRequestPolicy& InPolicy)
 		: FAccelByteTask{}
 		, Request{ InRequest }
 		, CompleteDelegate{ InCompleteDelegate }
@@ -25,13 +26,10 @@ namespace AccelByte
 		, NextDelay{ InNextDelay }
 		, OnBearerAuthRejectDelegate{ InOnBearerAuthRejectDelegate }
 		, BearerAuthRejectedRefresh{ InBearerAuthRejectedRefresh }
+		, ResponseCodeHandlers{ InResponseCodeHandlers }
+		, Policy{ InPolicy }
 	{
 		TaskTime = RequestTime;
-		InitializeDefaultDelegates();
-		for (auto& Handler : HandlerDelegates)
-		{
-			ResponseCodeDelegates.Emplace(Handler.Key, Handler.Value);
-		}
 	}
 
 	FHttpRetryTask::~FHttpRetryTask()
@@ -48,6 +46,7 @@ namespace AccelByte
 		}
 
 		Request->ProcessRequest();
+		AttemptNum++;
 		TaskState = EAccelByteTaskState::Running;
 		return FAccelByteTask::Start();
 	}
@@ -101,7 +100,16 @@ namespace AccelByte
 
 		TaskTime = CurrentTime;
 
-		if (TaskState == EAccelByteTaskState::Paused)
+		if (TaskState == EAccelByteTaskState::Pending)
+		{
+			// Waiting for the scheduler rate limiter to start the request
+			if (IsTimedOut())
+			{
+				Cancel();
+			}
+			return;
+		}
+		else if (TaskState == EAccelByteTaskState::Paused)
 		{
 			double DeltaTime = TaskTime - PauseTime;
 			PauseDuration += DeltaTime;
@@ -119,15 +127,26 @@ namespace AccelByte
 			{
 				return;
 			}
+
+			// The route is throttled for every request, the scheduler sends it again once the route has a token
+			if (bIsThrottledRetry)
+			{
+				bIsThrottledRetry = false;
+				TaskState = EAccelByteTaskState::Pending;
+				return;
+			}
 			NextState = Retry();
 		}
 		
+		ServerRetryTime = 0.0;
+
 		const EHttpRequestStatus::Type RequestStatus = Request->GetStatus();
 		switch (RequestStatus)
 		{
 		case EHttpRequestStatus::Processing:
 			if (IsTimedOut()) 
 			{
+				ReportAttempt(true);
 				Cancel();
 				NextState = TaskState;
 			}
@@ -139,16 +158,37 @@ namespace AccelByte
 			if (Response.IsValid())
 			{
 				const int32 ResponseCode = Response->GetResponseCode();
-				if (ResponseCodeDelegates.Contains(ResponseCode))
+				ReportAttempt(ResponseCode >= EHttpResponseCodes::ServerError);
+
+				double ServerRetryDelay = 0.0;
+				if (FHttpRetryScheduler::GetServerRetryDelay(Response, ServerRetryDelay))
 				{
-					NextState = ResponseCodeDelegates[ResponseCode].Execute(ResponseCode);
+					ServerRetryTime = TaskTime + ServerRetryDelay;
+					if (AttemptDelegates.IsValid())
+					{
+						AttemptDelegates->OnThrottled.ExecuteIfBound(Route, ServerRetryTime);
+					}
+				}
+
+				// Custom handler takes precedence over the default one
+				const FHttpRetryScheduler::FHttpResponseCodeHandler* CustomHandler = ResponseCodeHandlers->Find(ResponseCode);
+				if (CustomHandler != nullptr && CustomHandler->IsBound())
+				{
+					NextState = CustomHandler->Execute(ResponseCode);
+				}
+				else
+				{
+					HandleDefaultResponseCode(ResponseCode, NextState);
 				}
 
 				if (NextState == EAccelByteTaskState::Pending 
 					|| NextState == EAccelByteTaskState::Running 
 					|| NextState == EAccelByteTaskState::Retrying)
 				{
-					if (!CheckRetry(NextState))
+					const bool bIsRejectedByServer = ResponseCode == EHttpResponseCodes::TooManyRequests
+						|| ResponseCode == EHttpResponseCodes::RetryWith
+						|| ResponseCode == EHttpResponseCodes::ServiceUnavail;
+					if (!CheckRetry(NextState, bIsRejectedByServer))
 					{
 						NextState = EAccelByteTaskState::Completed;
 					}
@@ -157,7 +197,11 @@ namespace AccelByte
 			break;
 		}
 		case EHttpRequestStatus::Failed_ConnectionError: //network error
-			CheckRetry(NextState);
+			ReportAttempt(true);
+			if (!CheckRetry(NextState, false))
+			{
+				NextState = EAccelByteTaskState::Completed;
+			}
 			break;
 		case EHttpRequestStatus::Failed: //request cancelled
 			Cancel();
@@ -177,8 +221,11 @@ namespace AccelByte
 
 		if (TaskState == EAccelByteTaskState::Completed || TaskState == EAccelByteTaskState::Cancelled || TaskState == EAccelByteTaskState::Failed)
 		{
-			FReport::LogHttpResponse(Request, Request->GetResponse());
-			CompleteDelegate.ExecuteIfBound(Request, Request->GetResponse(), IsFinished());
+			const FHttpResponsePtr Response = Request->GetResponse();
+			const bool bIsRequestFinished = IsFinished();
+
+			FReport::LogHttpResponse(Request, Response);
+			ExecuteCompleteDelegates(Response, bIsRequestFinished);
 		}
 		return FAccelByteTask::Finish();
 	}
@@ -188,49 +235,179 @@ namespace AccelByte
 		TaskState = EAccelByteTaskState::Completed;
 	
 		FReport::LogHttpResponse(Request, Response);
-		CompleteDelegate.ExecuteIfBound(Request, Response, true /*IsFinished()*/);
+		ExecuteCompleteDelegates(Response, true /*IsFinished()*/);
 
 		return FAccelByteTask::Finish();
 	}
 
-	void FHttpRetryTask::InitializeDefaultDelegates()
+	void FHttpRetryTask::Reject()
 	{
-		ResponseCodeDelegates = {
-			{
-				EHttpResponseCodes::RetryWith,
-				FHttpRetryScheduler::FHttpResponseCodeHandler::CreateRaw(this, &FHttpRetryTask::HandleDefaultRetry)
-			},
-			{
-				EHttpResponseCodes::ServerError,
-				FHttpRetryScheduler::FHttpResponseCodeHandler::CreateRaw(this, &FHttpRetryTask::HandleDefaultRetry)
-			},
-			{
-				EHttpResponseCodes::BadGateway,
-				FHttpRetryScheduler::FHttpResponseCodeHandler::CreateRaw(this, &FHttpRetryTask::HandleDefaultRetry)
-			},
-			{
-				EHttpResponseCodes::ServiceUnavail,
-				FHttpRetryScheduler::FHttpResponseCodeHandler::CreateRaw(this, &FHttpRetryTask::HandleDefaultRetry)
-			},
+		TaskState = EAccelByteTaskState::Failed;
+	}
+
+	int32 FHttpRetryTask::AddCoalescedCompleteDelegate(const FHttpRequestCompleteDelegate& InCompleteDelegate)
+	{
+		const int32 CallerId = NextCoalescedCallerId++;
+		CoalescedCompleteDelegates.Emplace(CallerId, InCompleteDelegate);
+		return CallerId;
+	}
+
+	bool FHttpRetryTask::RemoveCoalescedCompleteDelegate(int32 CallerId)
+	{
+		const int32 Index = CoalescedCompleteDelegates.IndexOfByPredicate(
+			[CallerId](const TPair<int32, FHttpRequestCompleteDelegate>& Caller) { return Caller.Key == CallerId; });
+		if (Index == INDEX_NONE)
+		{
+			return false;
+		}
+
+		const FHttpRequestCompleteDelegate RemovedDelegate = CoalescedCompleteDelegates[Index].Value;
+		CoalescedCompleteDelegates.RemoveAt(Index);
+
+		// Nobody is waiting for the response anymore, the scheduler cancels the request on its next poll
+		if (CoalescedCompleteDelegates.Num() == 0 && !CompleteDelegate.IsBound())
+		{
+			GetCancellationToken().Cancel();
+		}
+
+		RemovedDelegate.ExecuteIfBound(Request, nullptr, false);
+		return true;
+	}
+
+	void FHttpRetryTask::ExecuteCompleteDelegates(const FHttpResponsePtr& Response, bool bIsRequestFinished)
+	{
+		CompleteDelegate.ExecuteIfBound(Request, Response, bIsRequestFinished);
+
+		// A caller might detach another one from its delegate
+		const TArray<TPair<int32, FHttpRequestCompleteDelegate>> Callers = MoveTemp(CoalescedCompleteDelegates);
+		CoalescedCompleteDelegates.Empty();
+		for (const TPair<int32, FHttpRequestCompleteDelegate>& Caller : Callers)
+		{
+			Caller.Value.ExecuteIfBound(Request, Response, bIsRequestFinished);
+		}
+	}
+
+	FHttpCoalescedTask::FHttpCoalescedTask(const FAccelByteHttpRetryTaskPtr& InSharedTask, int32 InCallerId)
+		: SharedTask(InSharedTask)
+		, CallerId(InCallerId)
+	{
+		Token->OnCancelRequested().BindRaw(this, &FHttpCoalescedTask::Cancel);
+	}
+
+	FHttpCoalescedTask::~FHttpCoalescedTask()
+	{
+		Token->OnCancelRequested().Unbind();
+	}
+
+	bool FHttpCoalescedTask::Cancel()
+	{
+		if (TaskState == EAccelByteTaskState::Cancelled)
+		{
+			return false;
+		}
+
+		const FAccelByteHttpRetryTaskPtr SharedTaskPtr = SharedTask.Pin();
+		if (!SharedTaskPtr.IsValid() || !SharedTaskPtr->RemoveCoalescedCompleteDelegate(CallerId))
+		{
+			return false;
+		}
+
+		TaskState = EAccelByteTaskState::Cancelled;
+		return FAccelByteTask::Cancel();
+	}
+
+	EAccelByteTaskState FHttpCoalescedTask::State() const
+	{
+		if (TaskState == EAccelByteTaskState::Cancelled)
+		{
+			return TaskState;
+		}
+
+		// The shared task is only released once it is finished and the caller has been answered
+		const FAccelByteHttpRetryTaskPtr SharedTaskPtr = SharedTask.Pin();
+		return SharedTaskPtr.IsValid() ? SharedTaskPtr->State() : EAccelByteTaskState::Completed;
+	}
+
+	double FHttpCoalescedTask::Time() const
+	{
+		const FAccelByteHttpRetryTaskPtr SharedTaskPtr = SharedTask.Pin();
+		return SharedTaskPtr.IsValid() ? SharedTaskPtr->Time() : TaskTime;
+	}
+
+	double FHttpRetryTask::GetNextTickTime() const
+	{
+		switch (TaskState)
+		{
+		case EAccelByteTaskState::Pending:
+			return RequestTime + PauseDuration + Policy.Deadline;
+		case EAccelByteTaskState::Running:
+			if (Request.IsValid() && Request->GetStatus() == EHttpRequestStatus::Processing)
 			{
-				EHttpResponseCodes::GatewayTimeout,
-				FHttpRetryScheduler::FHttpResponseCodeHandler::CreateRaw(this, &FHttpRetryTask::HandleDefaultRetry)
+				return RequestTime + PauseDuration + Policy.Deadline;
 			}
-		};
+			return TaskTime;
+		case EAccelByteTaskState::Retrying:
+			return NextRetryTime;
+		case EAccelByteTaskState::Paused:
+			return PauseTime + FMath::Max(FHttpRetryScheduler::PauseTimeout - PauseDuration, 0.0);
+		default:
+			return TaskTime;
+		}
+	}
 
-		ResponseCodeDelegates.Emplace(EHttpResponseCodes::Denied, 
-			FHttpRetryScheduler::FHttpResponseCodeHandler::CreateLambda(
-			[this](int32 StatusCode) -> EAccelByteTaskState {
-				EAccelByteTaskState Result = EAccelByteTaskState::Failed;
-#if !UE_SERVER
-				if (IsRefreshable())
+	void FHttpRetryTask::SetWakeUpDelegate(const FSimpleDelegate& InWakeUpDelegate)
+	{
+		Token->OnCancelRequested() = InWakeUpDelegate;
+
+		if (Request.IsValid())
+		{
+			Request->OnProcessRequestComplete().BindLambda(
+				[InWakeUpDelegate](FHttpRequestPtr, FHttpResponsePtr, bool)
 				{
-					UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Denied and will refresh with Status Code %d"), StatusCode);
-					Result = Pause();
-				}
+					InWakeUpDelegate.ExecuteIfBound();
+				});
+		}
+	}
+
+	void FHttpRetryTask::ReportAttempt(bool bIsFailed)
+	{
+		if (AttemptDelegates.IsValid())
+		{
+			AttemptDelegates->OnAttemptCompleted.ExecuteIfBound(Route, TaskTime, bIsFailed);
+		}
+	}
+
+	bool FHttpRetryTask::HandleDefaultResponseCode(int32 StatusCode, EAccelByteTaskState& OutState)
+	{
+		switch (StatusCode)
+		{
+		case EHttpResponseCodes::RetryWith:
+		case EHttpResponseCodes::TooManyRequests:
+		case EHttpResponseCodes::ServerError:
+		case EHttpResponseCodes::BadGateway:
+		case EHttpResponseCodes::ServiceUnavail:
+		case EHttpResponseCodes::GatewayTimeout:
+			OutState = HandleDefaultRetry(StatusCode);
+			return true;
+		case EHttpResponseCodes::Denied:
+			OutState = HandleDenied(StatusCode);
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	EAccelByteTaskState FHttpRetryTask::HandleDenied(int32 StatusCode)
+	{
+		EAccelByteTaskState Result = EAccelByteTaskState::Failed;
+#if !UE_SERVER
+		if (IsRefreshable())
+		{
+			UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Denied and will refresh with Status Code %d"), StatusCode);
+			Result = Pause();
+		}
 #endif
-				return Result;
-			}));
+		return Result;
 	}
 
 	void FHttpRetryTask::BearerAuthUpdated(const FString& AccessToken)
@@ -252,8 +429,9 @@ namespace AccelByte
 		Request->SetHeader(TEXT("Authorization"), Authorization);
 
 		UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Bearer token updated, Task will be resumed"));
-		TaskState = EAccelByteTaskState::Retrying;
-		NextRetryTime = FPlatformTime::Seconds();
+
+		// Started again by the scheduler, through the rate limiter and the dispatch limit like a new request
+		TaskState = EAccelByteTaskState::Pending;
 	}
 
 	EAccelByteTaskState FHttpRetryTask::HandleDefaultRetry(int32 StatusCode)
@@ -263,11 +441,26 @@ namespace AccelByte
 		return EAccelByteTaskState::Retrying;
 	}
 
-	bool FHttpRetryTask::CheckRetry(EAccelByteTaskState& Out)
+	bool FHttpRetryTask::CheckRetry(EAccelByteTaskState& Out, bool bIsRejectedByServer)
 	{
 		bool WillRetry = false;
 
-		if (!IsTimedOut())
+		if (!Policy.bIsIdempotent && !bIsRejectedByServer)
+		{
+			UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Request is not idempotent and might have been processed, it will not be retried"));
+			return WillRetry;
+		}
+
+		if (Policy.MaxAttempts > 0 && AttemptNum >= Policy.MaxAttempts)
+		{
+			UE_LOG(LogAccelByteHttpRetry, Verbose, TEXT("Request reached its maximum attempts %d"), Policy.MaxAttempts);
+			return WillRetry;
+		}
+
+		if (!IsTimedOut()
+			&& (!AttemptDelegates.IsValid()
+				|| !AttemptDelegates->OnRetryRequested.IsBound()
+				|| AttemptDelegates->OnRetryRequested.Execute(Route, TaskTime)))
 		{
 			Out = ScheduleNextRetry();
 			WillRetry = true;
@@ -287,19 +480,28 @@ namespace AccelByte
 
 	EAccelByteTaskState FHttpRetryTask::ScheduleNextRetry()
 	{
-		NextDelay *= 2;
-		NextDelay += FMath::RandRange((float)-NextDelay, (float)NextDelay) / 4;
-
-		if (NextDelay > FHttpRetryScheduler::MaximumDelay)
+		if (ServerRetryTime > 0.0)
 		{
-			NextDelay = FHttpRetryScheduler::MaximumDelay;
+			// Retry when the server allows it instead of the backoff, at the rate of the route
+			NextRetryTime = ServerRetryTime;
+			bIsThrottledRetry = true;
 		}
+		else
+		{
+			NextDelay *= Policy.BackoffMultiplier;
+			NextDelay += FMath::RandRange((float)-NextDelay, (float)NextDelay) / 4;
 
-		NextRetryTime = TaskTime + NextDelay;
+			if (NextDelay > Policy.MaximumDelay)
+			{
+				NextDelay = Policy.MaximumDelay;
+			}
+
+			NextRetryTime = TaskTime + NextDelay;
+		}
 
-		if (NextRetryTime > RequestTime + PauseDuration + FHttpRetryScheduler::TotalTimeout)
+		if (NextRetryTime > RequestTime + PauseDuration + Policy.Deadline)
 		{
-			NextRetryTime = RequestTime + PauseDuration + FHttpRetryScheduler::TotalTimeout;
+			NextRetryTime = RequestTime + PauseDuration + Policy.Deadline;
 		}
 
 		Request->OnRequestWillRetry().ExecuteIfBound(Request, Request->GetResponse(), NextRetryTime);
@@ -332,7 +534,7 @@ namespace AccelByte
 
 	bool FHttpRetryTask::IsTimedOut()
 	{
-		return TaskTime >= RequestTime + PauseDuration + FHttpRetryScheduler::TotalTimeout;
+		return TaskTime >= RequestTime + PauseDuration + Policy.Deadline;
 	}
 
 
@@ -23,7 +23,8 @@ namespace AccelByte
 			double InNextDelay,
 			const FVoidHandler& InOnBearerAuthRejectDelegate,
 			FBearerAuthRejectedRefresh& InBearerAuthRejectedRefresh,
-			TMap<EHttpResponseCodes::Type, FHttpRetryScheduler::FHttpResponseCodeHandler> HandlerDelegates = {});
+			const FHttpRetryScheduler::FHttpResponseCodeHandlersRef& InResponseCodeHandlers,
+			const FHttpRequestPolicy& InPolicy);
 		virtual ~FHttpRetryTask() override;
 
 		virtual bool Start() override;
@@ -32,10 +33,70 @@ namespace AccelByte
 		virtual bool Finish() override;
 		bool FinishFromCached(const FHttpResponsePtr& Response);
 
+		/**
+		 * @brief Finish the task without sending the request, e.g. the circuit breaker of its route is open.
+		 */
+		void Reject();
+
 		virtual EAccelByteTaskState Pause() override;
 
 		FHttpRequestPtr GetHttpRequest() const { return Request; };
 
+		/**
+		 * @brief Get the earliest time the task needs to be ticked again by the scheduler.
+		 * Running task only wakes up on its timeout, the request completion is signaled through the wake up delegate.
+		 */
+		double GetNextTickTime() const;
+
+		/**
+		 * @brief Set the delegate to notify the scheduler that the task needs to be ticked as soon as possible,
+		 * executed when the HTTP request is completed or a cancellation is requested.
+		 */
+		void SetWakeUpDelegate(const FSimpleDelegate& InWakeUpDelegate);
+
+		/**
+		 * @brief Complete an identical request with this task's response instead of sending it again.
+		 *
+		 * @return Id of the caller, to detach it later.
+		 */
+		int32 AddCoalescedCompleteDelegate(const FHttpRequestCompleteDelegate& InCompleteDelegate);
+
+		/**
+		 * @brief Detach a caller, its delegate is executed right away as a cancelled request.
+		 * The request itself is cancelled once no caller is attached anymore.
+		 *
+		 * @return false if the caller is not attached, e.g. the task is already finished.
+		 */
+		bool RemoveCoalescedCompleteDelegate(int32 CallerId);
+
+		/**
+		 * @brief Set the scheduler callbacks to report each attempt, ask for the retries and report the throttling,
+		 * they are given the route of the task.
+		 */
+		void SetAttemptDelegates(const FHttpRetryScheduler::FRequestAttemptDelegatesPtr& InAttemptDelegates) { AttemptDelegates = InAttemptDelegates; }
+
+		/**
+		 * @brief Rate limit route of the request, see FHttpRetryScheduler::GetRequestRoute.
+		 */
+		const FString& GetRoute() const { return Route; }
+		void SetRoute(FString InRoute) { Route = MoveTemp(InRoute); }
+
+		const FHttpRequestPolicy& GetPolicy() const { return Policy; }
+		int32 GetAttemptNum() const { return AttemptNum; }
+
+		EAccelByteHttpRequestPriority GetPriority() const { return Priority; }
+		void SetPriority(EAccelByteHttpRequestPriority InPriority) { Priority = InPriority; }
+		bool IsDispatched() const { return bIsDispatched; }
+		void SetDispatched(bool bInIsDispatched) { bIsDispatched = bInIsDispatched; }
+
+		const FString& GetCoalescingKey() const { return CoalescingKey; }
+		void SetCoalescingKey(const FString& InCoalescingKey) { CoalescingKey = InCoalescingKey; }
+
+		uint32 GetScheduleGeneration() const { return ScheduleGeneration; }
+		uint32 IncrementScheduleGeneration() { return ++ScheduleGeneration; }
+		bool IsScheduleRetired() const { return bIsScheduleRetired; }
+		void RetireSchedule() { bIsScheduleRetired = true; }
+
 	private:
 		FHttpRequestPtr Request{};
 		const FHttpRequestCompleteDelegate CompleteDelegate{};
@@ -44,24 +105,62 @@ namespace AccelByte
 		double PauseDuration{};
 		double NextRetryTime{};
 		double NextDelay{};
+		/** Retry time directed by the server for the current response, 0 when the backoff is used. */
+		double ServerRetryTime{};
+		/** Whether the next retry waits for a token of the throttled route instead of being sent right away. */
+		bool bIsThrottledRetry{};
 		const FVoidHandler OnBearerAuthRejectDelegate{};
 		FBearerAuthRejectedRefresh& BearerAuthRejectedRefresh;
 		FDelegateHandle BearerAuthRejectedRefreshHandle{};
 		bool bIsBeenRunFromPause{};
-		TMap<int32, FHttpRetryScheduler::FHttpResponseCodeHandler> ResponseCodeDelegates{};
+		const FHttpRetryScheduler::FHttpResponseCodeHandlersRef ResponseCodeHandlers;
+		const FHttpRequestPolicy Policy{};
+		int32 AttemptNum{};
+		TArray<TPair<int32, FHttpRequestCompleteDelegate>> CoalescedCompleteDelegates{};
+		int32 NextCoalescedCallerId{};
+		FString CoalescingKey{};
+		EAccelByteHttpRequestPriority Priority{ EAccelByteHttpRequestPriority::Interactive };
+		bool bIsDispatched{};
+		uint32 ScheduleGeneration{};
+		bool bIsScheduleRetired{};
+		FString Route{};
+		FHttpRetryScheduler::FRequestAttemptDelegatesPtr AttemptDelegates{};
 
-		void InitializeDefaultDelegates();
+		bool HandleDefaultResponseCode(int32 StatusCode, EAccelByteTaskState& OutState);
+		EAccelByteTaskState HandleDenied(int32 StatusCode);
 		void BearerAuthUpdated(const FString& AccessToken);
 		EAccelByteTaskState HandleDefaultRetry(int32 StatusCode);
-		bool CheckRetry(EAccelByteTaskState& Out);
+		bool CheckRetry(EAccelByteTaskState& Out, bool bIsRejectedByServer);
 		EAccelByteTaskState Retry();
 		EAccelByteTaskState ScheduleNextRetry();
 		bool IsFinished();
 		bool IsRefreshable();
 		bool IsTimedOut();
+		void ReportAttempt(bool bIsFailed);
+		void ExecuteCompleteDelegates(const FHttpResponsePtr& Response, bool bIsRequestFinished);
 	};
 
 	typedef TSharedPtr<FHttpRetryTask, ESPMode::ThreadSafe> FAccelByteHttpRetryTaskPtr;
 	typedef TSharedRef<FHttpRetryTask, ESPMode::ThreadSafe> FAccelByteHttpRetryTaskRef;
+	typedef TWeakPtr<FHttpRetryTask, ESPMode::ThreadSafe> FAccelByteHttpRetryTaskWeakPtr;
+
+	/**
+	 * @brief Handle given to each caller of a coalesced request, the request is shared but the cancellation is not.
+	 * Cancelling the handle only detaches the caller, the shared request goes on for the other callers.
+	 */
+	class FHttpCoalescedTask : public FAccelByteTask
+	{
+	public:
+		FHttpCoalescedTask(const FAccelByteHttpRetryTaskPtr& InSharedTask, int32 InCallerId);
+		virtual ~FHttpCoalescedTask() override;
+
+		virtual bool Cancel() override;
+		virtual EAccelByteTaskState State() const override;
+		virtual double Time() const override;
+
+	private:
+		FAccelByteHttpRetryTaskWeakPtr SharedTask;
+		const int32 CallerId;
+	};
 
 }
\ No newline at end of file
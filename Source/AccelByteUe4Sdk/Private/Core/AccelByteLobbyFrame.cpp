@@ -0,0 +1,551 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteLobbyFrame.h"
+#include "Core/AccelByteMessageParser.h"
+#include "Core/AccelByteReport.h"
+#include "JsonObjectConverter.h"
+#include "Core/AccelByteTypeConverter.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace AccelByte
+{
+
+namespace
+{
+	FStringView TrimView(const TCHAR* Begin, const TCHAR* End)
+	{
+		while (Begin < End && FChar::IsWhitespace(*Begin))
+		{
+			++Begin;
+		}
+		while (End > Begin && FChar::IsWhitespace(*(End - 1)))
+		{
+			--End;
+		}
+		return FStringView(Begin, static_cast<int32>(End - Begin));
+	}
+
+	bool IsDateTimeProperty(const FProperty* Property)
+	{
+		const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+		return StructProperty != nullptr && StructProperty->Struct == TBaseStructure<FDateTime>::Get();
+	}
+
+	// The values that can't be written without a JSON conversion of their own
+	bool IsCompositeProperty(const FProperty* Property)
+	{
+		return (CastField<FStructProperty>(Property) != nullptr && !IsDateTimeProperty(Property))
+			|| CastField<FArrayProperty>(Property) != nullptr
+			|| CastField<FMapProperty>(Property) != nullptr
+			|| CastField<FSetProperty>(Property) != nullptr
+			|| CastField<FObjectPropertyBase>(Property) != nullptr;
+	}
+
+	int64 GetEnumValue(const UEnum* Enum, const FString& Name)
+	{
+		const int64 Value = Enum->GetValueByNameString(Name);
+		if (Value == INDEX_NONE)
+		{
+			UE_LOG(LogJson, Warning, TEXT("EnumJsonValueToInt64 - Unknown Enum value %s"), *Name);
+			return 0;
+		}
+		return Value;
+	}
+}
+
+FAccelByteLobbyFrame::FAccelByteLobbyFrame(const FString& InMessage)
+	: Message(InMessage)
+	, ParseCursor(*InMessage)
+{
+}
+
+const FAccelByteLobbyFrame::FFieldArray& FAccelByteLobbyFrame::GetFields() const
+{
+	while (ParseNextField())
+	{
+	}
+	return Fields;
+}
+
+bool FAccelByteLobbyFrame::ParseNextField() const
+{
+	const TCHAR* const End = *Message + Message.Len();
+	while (ParseCursor < End)
+	{
+		const TCHAR* const LineBegin = ParseCursor;
+		const TCHAR* LineEnd = LineBegin;
+		while (LineEnd < End && *LineEnd != TCHAR('\n'))
+		{
+			++LineEnd;
+		}
+		ParseCursor = LineEnd < End ? LineEnd + 1 : End;
+
+		// The name ends at the first ": ", the value can contain more of them
+		for (const TCHAR* Separator = LineBegin; Separator + 1 < LineEnd; ++Separator)
+		{
+			if (Separator[0] == TCHAR(':') && Separator[1] == TCHAR(' '))
+			{
+				Fields.Add(FField{ FStringView(LineBegin, static_cast<int32>(Separator - LineBegin)), TrimView(Separator + 2, LineEnd) });
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+bool FAccelByteLobbyFrame::TryGetField(const TCHAR* Name, FStringView& OutValue) const
+{
+	for (const FField& Field : Fields)
+	{
+		if (Field.Name.Equals(Name, ESearchCase::IgnoreCase))
+		{
+			OutValue = Field.Value;
+			return true;
+		}
+	}
+
+	// The header fields come first, the body is only sliced when a later field is asked for
+	while (ParseNextField())
+	{
+		const FField& Field = Fields.Last();
+		if (Field.Name.Equals(Name, ESearchCase::IgnoreCase))
+		{
+			OutValue = Field.Value;
+			return true;
+		}
+	}
+	return false;
+}
+
+FString FAccelByteLobbyFrame::GetStringField(const TCHAR* Name) const
+{
+	FStringView Value;
+	return TryGetField(Name, Value) ? FAccelByteLobbyFrameDecoder::UnquoteValue(Value) : FString();
+}
+
+int32 FAccelByteLobbyFrame::GetIntegerField(const TCHAR* Name) const
+{
+	return FCString::Atoi(*GetStringField(Name));
+}
+
+FString FAccelByteLobbyFrame::ToJsonString() const
+{
+	bool bFirst = true;
+	FString JsonString = TEXT("{");
+	for (const FField& Field : GetFields())
+	{
+		if (bFirst)
+		{
+			bFirst = false;
+		}
+		else
+		{
+			JsonString.Append(",");
+		}
+		JsonString.Append("\"");
+		JsonString.Append(Field.Name.GetData(), Field.Name.Len());
+		JsonString.Append("\":");
+
+		if (Field.Value.Len() == 0)
+		{
+			JsonString.Append("null");
+			continue;
+		}
+
+		// The parser walks up to the null terminator
+		const FString Value(Field.Value.Len(), Field.Value.GetData());
+		const TCHAR* Cursor = *Value;
+
+		// Array
+		if (*Cursor == '[')
+		{
+			++Cursor;
+			// skip spaces
+			while (*Cursor && *Cursor == ' ') ++Cursor;
+			bool bWasArrayParsed;
+			FString JsonArrayString;
+			// array of JSON object
+			if (*Cursor == '{')
+			{
+				bWasArrayParsed = MessageParser::ParseArrayOfObject(Cursor, JsonArrayString);
+			}
+			// array of string
+			else
+			{
+				bWasArrayParsed = MessageParser::ParseArrayOfString(Cursor, JsonArrayString);
+			}
+
+			if (bWasArrayParsed)
+			{
+				JsonString.Append(JsonArrayString);
+			}
+			else
+			{
+				// if the array was not parsed, set to empty array
+				JsonString.Append("[]");
+				UE_LOG(LogAccelByte, Warning, TEXT("[LobbyMessageToJson] Invalid array for field '%s', set to empty array"), *FString(Field.Name.Len(), Field.Name.GetData()));
+			}
+		}
+		// JSON
+		else if (*Cursor == '{')
+		{
+			FString ObjectString;
+			// only append valid object
+			if (MessageParser::ParseObject(Cursor, ObjectString))
+			{
+				JsonString.Append(ObjectString);
+			}
+			else
+			{
+				JsonString.Append("{}");
+				UE_LOG(LogAccelByte, Warning, TEXT("[LobbyMessageToJson] Invalid object for field '%s', set to empty object"), *FString(Field.Name.Len(), Field.Name.GetData()));
+			}
+		}
+		// everything else
+		else
+		{
+			MessageParser::ParseString(Cursor, JsonString);
+		}
+	}
+
+	JsonString += TEXT("}");
+	return JsonString;
+}
+
+TSharedPtr<FJsonObject> FAccelByteLobbyFrame::ToJsonObject() const
+{
+	TSharedPtr<FJsonObject> JsonObject;
+	const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ToJsonString());
+	if (!FJsonSerializer::Deserialize(JsonReader, JsonObject))
+	{
+		return nullptr;
+	}
+	return JsonObject;
+}
+
+bool FAccelByteLobbyFrameDecoder::DecodeStruct(const FAccelByteLobbyFrame& Frame, const UStruct* Definition, void* OutStruct)
+{
+	bool bSuccess = true;
+	for (const FAccelByteLobbyFrame::FField& Field : Frame.GetFields())
+	{
+		// The names are case-insensitive, a field that is not a name yet can't be a property either
+		const FName Name(Field.Name.Len(), Field.Name.GetData(), FNAME_Find);
+		FProperty* Property = Name.IsNone() ? nullptr : FindFProperty<FProperty>(Definition, Name);
+		if (Property == nullptr)
+		{
+			continue;
+		}
+
+		if (!DecodeProperty(Property, Field.Value, Property->ContainerPtrToValuePtr<void>(OutStruct)))
+		{
+			UE_LOG(LogJson, Warning, TEXT("LobbyFrameDecoder - Unable to decode field %s of %s"), *Property->GetName(), *Definition->GetName());
+			bSuccess = false;
+		}
+	}
+	return bSuccess;
+}
+
+FString FAccelByteLobbyFrameDecoder::UnquoteValue(FStringView Value)
+{
+	const TCHAR* Begin = Value.GetData();
+	const TCHAR* End = Begin + Value.Len();
+	if (Begin < End && *Begin == TCHAR('"'))
+	{
+		++Begin;
+	}
+	if (End > Begin && *(End - 1) == TCHAR('"'))
+	{
+		// Only an unescaped quote closes the value
+		int32 BackslashNum = 0;
+		for (const TCHAR* Cursor = End - 2; Cursor >= Begin && *Cursor == TCHAR('\\'); --Cursor)
+		{
+			++BackslashNum;
+		}
+		if (BackslashNum % 2 == 0)
+		{
+			--End;
+		}
+	}
+
+	FString Output;
+	Output.Reserve(static_cast<int32>(End - Begin));
+	for (const TCHAR* Cursor = Begin; Cursor < End; ++Cursor)
+	{
+		if (*Cursor != TCHAR('\\') || Cursor + 1 >= End)
+		{
+			Output.AppendChar(*Cursor);
+			continue;
+		}
+
+		const TCHAR Escaped = *++Cursor;
+		switch (Escaped)
+		{
+		case TCHAR('n'): Output.AppendChar(TCHAR('\n')); break;
+		case TCHAR('r'): Output.AppendChar(TCHAR('\r')); break;
+		case TCHAR('t'): Output.AppendChar(TCHAR('\t')); break;
+		case TCHAR('b'): Output.AppendChar(TCHAR('\b')); break;
+		case TCHAR('f'): Output.AppendChar(TCHAR('\f')); break;
+		case TCHAR('"'):
+		case TCHAR('\\'):
+		case TCHAR('/'): Output.AppendChar(Escaped); break;
+		case TCHAR('u'):
+			if (Cursor + 4 < End && FChar::IsHexDigit(Cursor[1]) && FChar::IsHexDigit(Cursor[2]) && FChar::IsHexDigit(Cursor[3]) && FChar::IsHexDigit(Cursor[4]))
+			{
+				const FString Hex(4, Cursor + 1);
+				Output.AppendChar(static_cast<TCHAR>(FParse::HexNumber(*Hex)));
+				Cursor += 4;
+				break;
+			}
+			// fallthrough, kept as is
+		default:
+			Output.AppendChar(TCHAR('\\'));
+			Output.AppendChar(Escaped);
+			break;
+		}
+	}
+	return Output;
+}
+
+bool FAccelByteLobbyFrameDecoder::DecodeProperty(FProperty* Property, FStringView Value, void* OutValue)
+{
+	// Converted to a JSON null before, the default value is kept
+	if (Value.Len() == 0)
+	{
+		return true;
+	}
+
+	if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		return DecodeArray(ArrayProperty, Value, OutValue);
+	}
+
+	if (*Value.GetData() == TCHAR('{') || IsCompositeProperty(Property))
+	{
+		return DecodeAsJson(Property, Value, OutValue);
+	}
+
+	return DecodeScalar(Property, Value, OutValue);
+}
+
+bool FAccelByteLobbyFrameDecoder::DecodeScalar(FProperty* Property, FStringView Value, void* OutValue)
+{
+	if (FStrProperty* StringProperty = CastField<FStrProperty>(Property))
+	{
+		StringProperty->SetPropertyValue(OutValue, UnquoteValue(Value));
+		return true;
+	}
+
+	if (IsCompositeProperty(Property))
+	{
+		return DecodeAsJson(Property, Value, OutValue);
+	}
+
+	const FString String = UnquoteValue(Value);
+	if (FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+	{
+		const UEnum* Enum = EnumProperty->GetEnum();
+		if (Enum == nullptr)
+		{
+			return false;
+		}
+		EnumProperty->GetUnderlyingProperty()->SetIntPropertyValue(OutValue, GetEnumValue(Enum, String));
+		return true;
+	}
+
+	if (FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+	{
+		if (const UEnum* Enum = NumericProperty->GetIntPropertyEnum())
+		{
+			NumericProperty->SetIntPropertyValue(OutValue, GetEnumValue(Enum, String));
+		}
+		else if (NumericProperty->IsFloatingPoint())
+		{
+			NumericProperty->SetFloatingPointPropertyValue(OutValue, FCString::Atod(*String));
+		}
+		else
+		{
+			NumericProperty->SetIntPropertyValue(OutValue, FCString::Atoi64(*String));
+		}
+		return true;
+	}
+
+	if (FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+	{
+		BoolProperty->SetPropertyValue(OutValue, FCString::ToBool(*String));
+		return true;
+	}
+
+	if (FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+	{
+		NameProperty->SetPropertyValue(OutValue, FName(*String));
+		return true;
+	}
+
+	if (FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+	{
+		TextProperty->SetPropertyValue(OutValue, FText::FromString(String));
+		return true;
+	}
+
+	if (IsDateTimeProperty(Property))
+	{
+		FDateTime& DateTime = *static_cast<FDateTime*>(OutValue);
+		return FDateTime::ParseIso8601(*String, DateTime) || FDateTime::Parse(String, DateTime);
+	}
+
+	return DecodeAsJson(Property, Value, OutValue);
+}
+
+bool FAccelByteLobbyFrameDecoder::DecodeArray(FArrayProperty* ArrayProperty, FStringView Value, void* OutValue)
+{
+	const TCHAR* Cursor = Value.GetData();
+	const TCHAR* const End = Cursor + Value.Len();
+	if (*Cursor != TCHAR('[') || IsCompositeProperty(ArrayProperty->Inner))
+	{
+		return DecodeAsJson(ArrayProperty, Value, OutValue);
+	}
+
+	++Cursor;
+	const FStringView FirstItem = TrimView(Cursor, End);
+	if (FirstItem.Len() > 0 && *FirstItem.GetData() == TCHAR('{'))
+	{
+		return DecodeAsJson(ArrayProperty, Value, OutValue);
+	}
+
+	// The items are separated by the commas outside of the quotes
+	TArray<FStringView, TInlineAllocator<16>> Items;
+	const TCHAR* ItemBegin = Cursor;
+	bool bIsQuoted = false;
+	bool bIsEscape = false;
+	bool bIsClosed = false;
+	for (; Cursor < End; ++Cursor)
+	{
+		if (bIsQuoted)
+		{
+			if (bIsEscape)
+			{
+				bIsEscape = false;
+			}
+			else if (*Cursor == TCHAR('\\'))
+			{
+				bIsEscape = true;
+			}
+			else if (*Cursor == TCHAR('"'))
+			{
+				bIsQuoted = false;
+			}
+		}
+		else if (*Cursor == TCHAR('"'))
+		{
+			bIsQuoted = true;
+		}
+		else if (*Cursor == TCHAR(',') || *Cursor == TCHAR(']'))
+		{
+			Items.Add(TrimView(ItemBegin, Cursor));
+			ItemBegin = Cursor + 1;
+			if (*Cursor == TCHAR(']'))
+			{
+				bIsClosed = true;
+				break;
+			}
+		}
+	}
+	if (!bIsClosed)
+	{
+		Items.Add(TrimView(ItemBegin, End));
+	}
+
+	// ignore empty for trailing comma at the end of array
+	if (Items.Num() > 0 && Items.Last().Len() == 0)
+	{
+		Items.Pop(false);
+	}
+
+	FScriptArrayHelper ArrayHelper(ArrayProperty, OutValue);
+	ArrayHelper.EmptyValues();
+	ArrayHelper.AddValues(Items.Num());
+	for (int32 Index = 0; Index < Items.Num(); Index++)
+	{
+		if (!DecodeScalar(ArrayProperty->Inner, Items[Index], ArrayHelper.GetRawPtr(Index)))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FAccelByteLobbyFrameDecoder::DecodeAsJson(FProperty* Property, FStringView Value, void* OutValue)
+{
+	// The parser walks up to the null terminator
+	const FString ValueString(Value.Len(), Value.GetData());
+	const TCHAR* Cursor = *ValueString;
+
+	TSharedPtr<FJsonValue> JsonValue;
+	if (*Cursor == TCHAR('{'))
+	{
+		FString ObjectString;
+		if (!MessageParser::ParseObject(Cursor, ObjectString))
+		{
+			ObjectString = TEXT("{}");
+		}
+
+		TSharedPtr<FJsonObject> JsonObject;
+		const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ObjectString);
+		if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+		{
+			return false;
+		}
+
+		if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			FAccelByteJsonConverter::HandleUnidentifiedEnum(JsonObject, StructProperty->Struct);
+		}
+		JsonValue = MakeShared<FJsonValueObject>(JsonObject);
+	}
+	else if (*Cursor == TCHAR('['))
+	{
+		++Cursor;
+		while (*Cursor && *Cursor == ' ') ++Cursor;
+
+		FString ArrayString;
+		const bool bWasArrayParsed = *Cursor == TCHAR('{')
+			? MessageParser::ParseArrayOfObject(Cursor, ArrayString)
+			: MessageParser::ParseArrayOfString(Cursor, ArrayString);
+		if (!bWasArrayParsed)
+		{
+			ArrayString = TEXT("[]");
+		}
+
+		TArray<TSharedPtr<FJsonValue>> JsonArray;
+		const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ArrayString);
+		if (!FJsonSerializer::Deserialize(JsonReader, JsonArray))
+		{
+			return false;
+		}
+
+		const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property);
+		const FStructProperty* InnerStructProperty = ArrayProperty != nullptr ? CastField<FStructProperty>(ArrayProperty->Inner) : nullptr;
+		if (InnerStructProperty != nullptr)
+		{
+			for (const TSharedPtr<FJsonValue>& Item : JsonArray)
+			{
+				if (Item.IsValid() && Item->Type == EJson::Object)
+				{
+					FAccelByteJsonConverter::HandleUnidentifiedEnum(Item->AsObject(), InnerStructProperty->Struct);
+				}
+			}
+		}
+		JsonValue = MakeShared<FJsonValueArray>(JsonArray);
+	}
+	else
+	{
+		JsonValue = MakeShared<FJsonValueString>(UnquoteValue(Value));
+	}
+
+	return FJsonObjectConverter::JsonValueToUProperty(JsonValue, Property, OutValue, 0, 0);
+}
+
+}
@@ -0,0 +1,372 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/AccelByteMemoryPool.h"
+
+namespace AccelByte
+{
+namespace Core
+{
+
+FAccelByteSlabArena::FAccelByteSlabArena(size_t InPoolSize, uint32 InPageSize)
+	: PageSize(FMath::Max(InPageSize, MaxSlotSize))
+{
+	const int32 PageNum = static_cast<int32>(InPoolSize / PageSize);
+	if (PageNum > 0)
+	{
+		Memory = static_cast<uint8*>(FMemory::Malloc(static_cast<SIZE_T>(PageNum) * PageSize));
+	}
+
+	const int32 MaxSlotNum = PageSize / MinSlotSize;
+	Pages.SetNum(PageNum);
+	FreePages.Reserve(PageNum);
+	for (int32 PageIndex = PageNum - 1; PageIndex >= 0; PageIndex--)
+	{
+		Pages[PageIndex].FreeSlots.Reserve(MaxSlotNum);
+		Pages[PageIndex].SlotOwners.Reserve(MaxSlotNum);
+		FreePages.Add(PageIndex);
+	}
+
+	Stats.CapacityBytes = static_cast<size_t>(PageNum) * PageSize;
+	Stats.PageNum = PageNum;
+	Stats.FreePageNum = PageNum;
+}
+
+FAccelByteSlabArena::~FAccelByteSlabArena()
+{
+	if (Memory != nullptr)
+	{
+		FMemory::Free(Memory);
+		Memory = nullptr;
+	}
+}
+
+int32 FAccelByteSlabArena::GetSizeClass(int64 Size)
+{
+	int32 SizeClass = 0;
+	while (SizeClass < SizeClassNum - 1 && GetSlotSize(SizeClass) < Size)
+	{
+		SizeClass++;
+	}
+	return SizeClass;
+}
+
+size_t FAccelByteSlabArena::GetReservedSize(int64 Size)
+{
+	if (Size <= 0)
+	{
+		return 0;
+	}
+	const int64 FullSlotNum = Size / MaxSlotSize;
+	const int64 Tail = Size % MaxSlotSize;
+	return static_cast<size_t>(FullSlotNum) * MaxSlotSize + (Tail > 0 ? GetSlotSize(GetSizeClass(Tail)) : 0);
+}
+
+size_t FAccelByteSlabArena::GetReservedSize(int32 Handle) const
+{
+	if (!Entries.IsValidIndex(Handle) || !Entries[Handle].bIsUsed)
+	{
+		return 0;
+	}
+	return GetReservedSize(Entries[Handle].Size);
+}
+
+uint8* FAccelByteSlabArena::GetSlotData(const FSlot& Slot) const
+{
+	const FPage& Page = Pages[Slot.Page];
+	return Memory + static_cast<SIZE_T>(Slot.Page) * PageSize + static_cast<SIZE_T>(Slot.Index) * GetSlotSize(Page.SizeClass);
+}
+
+int32 FAccelByteSlabArena::AcquirePage(int32 SizeClass)
+{
+	if (FreePages.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 PageIndex = FreePages.Pop(false);
+	FPage& Page = Pages[PageIndex];
+	const int32 SlotNum = PageSize / GetSlotSize(SizeClass);
+
+	Page.SizeClass = SizeClass;
+	Page.UsedSlotNum = 0;
+	Page.FreeSlots.Reset();
+	for (int32 SlotIndex = SlotNum - 1; SlotIndex >= 0; SlotIndex--)
+	{
+		Page.FreeSlots.Add(SlotIndex);
+	}
+	Page.SlotOwners.Reset();
+	Page.SlotOwners.SetNum(SlotNum);
+
+	Page.bIsPartial = true;
+	PartialPages[SizeClass].Add(PageIndex);
+	Stats.FreePageNum--;
+
+	return PageIndex;
+}
+
+void FAccelByteSlabArena::ReleasePage(int32 PageIndex)
+{
+	FPage& Page = Pages[PageIndex];
+	if (Page.bIsPartial)
+	{
+		PartialPages[Page.SizeClass].RemoveSingleSwap(PageIndex, false);
+		Page.bIsPartial = false;
+	}
+	Page.SizeClass = INDEX_NONE;
+	Page.UsedSlotNum = 0;
+	Page.FreeSlots.Reset();
+	Page.SlotOwners.Reset();
+
+	FreePages.Add(PageIndex);
+	Stats.FreePageNum++;
+}
+
+bool FAccelByteSlabArena::AllocateSlot(int32 SizeClass, const FSlotOwner& Owner, FSlot& OutSlot)
+{
+	TArray<int32>& Partial = PartialPages[SizeClass];
+	if (Partial.Num() == 0 && AcquirePage(SizeClass) == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const int32 PageIndex = Partial.Last();
+	FPage& Page = Pages[PageIndex];
+	const int32 SlotIndex = Page.FreeSlots.Pop(false);
+	Page.SlotOwners[SlotIndex] = Owner;
+	Page.UsedSlotNum++;
+
+	if (Page.FreeSlots.Num() == 0)
+	{
+		Partial.Pop(false);
+		Page.bIsPartial = false;
+	}
+
+	Stats.ReservedBytes += GetSlotSize(SizeClass);
+	OutSlot.Page = PageIndex;
+	OutSlot.Index = SlotIndex;
+	return true;
+}
+
+void FAccelByteSlabArena::FreeSlot(const FSlot& Slot)
+{
+	FPage& Page = Pages[Slot.Page];
+	Page.SlotOwners[Slot.Index] = FSlotOwner{};
+	Page.FreeSlots.Add(Slot.Index);
+	Page.UsedSlotNum--;
+	Stats.ReservedBytes -= GetSlotSize(Page.SizeClass);
+
+	if (Page.UsedSlotNum == 0)
+	{
+		// Empty pages go back to the free list right away so any size class can reuse them
+		ReleasePage(Slot.Page);
+	}
+	else if (!Page.bIsPartial)
+	{
+		Page.bIsPartial = true;
+		PartialPages[Page.SizeClass].Add(Slot.Page);
+	}
+}
+
+int32 FAccelByteSlabArena::Allocate(const uint8* Data, int64 Size)
+{
+	if (Size < 0 || (Size > 0 && Data == nullptr))
+	{
+		return INDEX_NONE;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	const int32 Handle = FreeEntries.Num() > 0 ? FreeEntries.Pop(false) : Entries.AddDefaulted();
+	{
+		FEntry& Entry = Entries[Handle];
+		Entry.bIsUsed = true;
+		Entry.Size = Size;
+		Entry.Segments.Reset();
+	}
+
+	bool bIsCompacted = false;
+	int64 Offset = 0;
+	while (Offset < Size)
+	{
+		const int64 SegmentSize = FMath::Min<int64>(Size - Offset, MaxSlotSize);
+		const FSlotOwner Owner{ Handle, Entries[Handle].Segments.Num() };
+
+		FSlot Slot;
+		if (!AllocateSlot(GetSizeClass(SegmentSize), Owner, Slot))
+		{
+			if (!bIsCompacted)
+			{
+				Compact();
+				bIsCompacted = true;
+				continue;
+			}
+
+			FreeEntry(Handle);
+			Stats.FailedAllocationNum++;
+			return INDEX_NONE;
+		}
+
+		Entries[Handle].Segments.Add(Slot);
+		FMemory::Memcpy(GetSlotData(Slot), Data + Offset, SegmentSize);
+		Offset += SegmentSize;
+	}
+
+	Stats.UsedBytes += Size;
+	Stats.EntryNum++;
+	Stats.AllocationNum++;
+	Stats.WrittenBytes += Size;
+	Stats.WriteSeconds += FPlatformTime::Seconds() - StartTime;
+
+	return Handle;
+}
+
+bool FAccelByteSlabArena::Read(int32 Handle, TArray<uint8>& OutData)
+{
+	if (!Entries.IsValidIndex(Handle) || !Entries[Handle].bIsUsed)
+	{
+		return false;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	const FEntry& Entry = Entries[Handle];
+	OutData.SetNumUninitialized(Entry.Size, false);
+
+	int64 Offset = 0;
+	for (const FSlot& Slot : Entry.Segments)
+	{
+		const int64 SegmentSize = FMath::Min<int64>(Entry.Size - Offset, MaxSlotSize);
+		FMemory::Memcpy(OutData.GetData() + Offset, GetSlotData(Slot), SegmentSize);
+		Offset += SegmentSize;
+	}
+
+	Stats.ReadBytes += Entry.Size;
+	Stats.ReadSeconds += FPlatformTime::Seconds() - StartTime;
+
+	return true;
+}
+
+void FAccelByteSlabArena::FreeEntry(int32 Handle)
+{
+	FEntry& Entry = Entries[Handle];
+	for (const FSlot& Slot : Entry.Segments)
+	{
+		FreeSlot(Slot);
+	}
+	Entry.Segments.Reset();
+	Entry.Size = 0;
+	Entry.bIsUsed = false;
+	FreeEntries.Add(Handle);
+}
+
+void FAccelByteSlabArena::Free(int32 Handle)
+{
+	if (!Entries.IsValidIndex(Handle) || !Entries[Handle].bIsUsed)
+	{
+		return;
+	}
+
+	Stats.UsedBytes -= Entries[Handle].Size;
+	Stats.EntryNum--;
+	Stats.FreeNum++;
+	FreeEntry(Handle);
+}
+
+void FAccelByteSlabArena::Reset()
+{
+	for (int32 Handle = 0; Handle < Entries.Num(); Handle++)
+	{
+		Free(Handle);
+	}
+}
+
+void FAccelByteSlabArena::MoveSlot(int32 FromPage, int32 FromIndex, int32 ToPage)
+{
+	FPage& Source = Pages[FromPage];
+	FPage& Target = Pages[ToPage];
+
+	const FSlot From{ FromPage, FromIndex };
+	const FSlot To{ ToPage, Target.FreeSlots.Pop(false) };
+	FMemory::Memcpy(GetSlotData(To), GetSlotData(From), GetSlotSize(Source.SizeClass));
+
+	const FSlotOwner Owner = Source.SlotOwners[FromIndex];
+	Entries[Owner.Entry].Segments[Owner.Segment] = To;
+
+	Target.SlotOwners[To.Index] = Owner;
+	Target.UsedSlotNum++;
+
+	Source.SlotOwners[FromIndex] = FSlotOwner{};
+	Source.FreeSlots.Add(FromIndex);
+	Source.UsedSlotNum--;
+
+	Stats.MovedSlotNum++;
+}
+
+void FAccelByteSlabArena::Compact()
+{
+	Stats.CompactionNum++;
+
+	for (int32 SizeClass = 0; SizeClass < SizeClassNum; SizeClass++)
+	{
+		TArray<int32>& Partial = PartialPages[SizeClass];
+		if (Partial.Num() < 2)
+		{
+			continue;
+		}
+
+		// Fill the densest pages first, the sparsest pages are drained from the back
+		Partial.Sort([this](int32 A, int32 B) { return Pages[A].UsedSlotNum > Pages[B].UsedSlotNum; });
+
+		int32 Target = 0;
+		int32 Source = Partial.Num() - 1;
+		int32 SourceSlot = 0;
+		while (Target < Source)
+		{
+			FPage& TargetPage = Pages[Partial[Target]];
+			FPage& SourcePage = Pages[Partial[Source]];
+			if (TargetPage.FreeSlots.Num() == 0)
+			{
+				Target++;
+				continue;
+			}
+			if (SourcePage.UsedSlotNum == 0)
+			{
+				Source--;
+				SourceSlot = 0;
+				continue;
+			}
+
+			while (SourcePage.SlotOwners[SourceSlot].Entry == INDEX_NONE)
+			{
+				SourceSlot++;
+			}
+			MoveSlot(Partial[Source], SourceSlot, Partial[Target]);
+		}
+
+		// Rebuild the partial list, the drained pages are released to every size class
+		TArray<int32> DrainedPages;
+		for (int32 Index = Partial.Num() - 1; Index >= 0; Index--)
+		{
+			const int32 PageIndex = Partial[Index];
+			FPage& Page = Pages[PageIndex];
+			if (Page.UsedSlotNum == 0)
+			{
+				DrainedPages.Add(PageIndex);
+			}
+			else if (Page.FreeSlots.Num() == 0)
+			{
+				Page.bIsPartial = false;
+				Partial.RemoveAtSwap(Index, 1, false);
+			}
+		}
+		for (const int32 PageIndex : DrainedPages)
+		{
+			ReleasePage(PageIndex);
+		}
+	}
+}
+
+}
+}
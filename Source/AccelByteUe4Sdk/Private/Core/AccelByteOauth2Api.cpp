@@ -75,7 +75,7 @@ void Oauth2::GetTokenWithAuthorizationCode(const FString& ClientId
 	}, TEXT(""));
 	Request->SetContentAsString(Content);
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EAccelByteHttpRequestPriority::Critical);
 }
 	
 void Oauth2::GetTokenWithPasswordCredentials(const FString& ClientId
@@ -124,7 +124,7 @@ void Oauth2::GetTokenWithPasswordCredentials(const FString& ClientId
 	}, TEXT(""));
 	Request->SetContentAsString(Content);
 	
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EAccelByteHttpRequestPriority::Critical);
 }
 
 void Oauth2::GetTokenWithClientCredentials(const FString& ClientId
@@ -141,7 +141,7 @@ void Oauth2::GetTokenWithClientCredentials(const FString& ClientId
 	FHttpRequestPtr Request = ConstructTokenRequest(Url, ClientId, ClientSecret);
 	Request->SetContentAsString(FString::Printf(TEXT("grant_type=client_credentials")));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EAccelByteHttpRequestPriority::Critical);
 }
 
 void Oauth2::GetTokenWithDeviceId(const FString& ClientId
@@ -175,7 +175,7 @@ void Oauth2::GetTokenWithDeviceId(const FString& ClientId
 	FHttpRequestPtr Request = ConstructTokenRequest(Url, ClientId, ClientSecret);
 	Request->SetContentAsString(FString::Printf(TEXT("device_id=%s"), *FGenericPlatformHttp::UrlEncode(*FAccelByteUtilities::GetDeviceId())));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds()); 
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EAccelByteHttpRequestPriority::Critical); 
 }
 	
 void Oauth2::GetTokenWithOtherPlatformToken(const FString& ClientId
@@ -225,7 +225,7 @@ void Oauth2::GetTokenWithOtherPlatformToken(const FString& ClientId
 		{TEXT("macAddress"), FGenericPlatformHttp::UrlEncode(FAccelByteUtilities::GetMacAddress(true)) }
 	}, TEXT(""));
 	Request->SetContentAsString(Content);
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EAccelByteHttpRequestPriority::Critical);
 }
 
 void Oauth2::GetTokenWithRefreshToken(const FString& ClientId
@@ -268,7 +268,7 @@ void Oauth2::GetTokenWithRefreshToken(const FString& ClientId
 	}, TEXT(""));
 	Request->SetContentAsString(Content);
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EAccelByteHttpRequestPriority::Critical);
 }
 
 void Oauth2::RevokeToken(const FString& AccessToken
@@ -288,7 +288,7 @@ void Oauth2::RevokeToken(const FString& AccessToken
 	Request->SetHeader(TEXT("Authorization"), TEXT("Bearer " + AccessToken));
 	Request->SetContentAsString(FString::Printf(TEXT("token=%s"), *FGenericPlatformHttp::UrlEncode(*AccessToken)));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EAccelByteHttpRequestPriority::Critical);
 }
 
 void Oauth2::RevokeToken(const FString& ClientId
@@ -327,7 +327,7 @@ void Oauth2::RevokeToken(const FString& ClientId
 	FHttpRequestPtr Request = ConstructTokenRequest(Url, ClientId, ClientSecret);
 	Request->SetContentAsString(FString::Printf(TEXT("token=%s"), *FGenericPlatformHttp::UrlEncode(*AccessToken)));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EAccelByteHttpRequestPriority::Critical);
 }
 
 void Oauth2::GetTokenWithAuthorizationCodeV3(const FString& ClientId
@@ -374,7 +374,7 @@ void Oauth2::GetTokenWithAuthorizationCodeV3(const FString& ClientId
 	}, TEXT(""));
 	Request->SetContentAsString(Content);
 	
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EAccelByteHttpRequestPriority::Critical);
 }
 
 void Oauth2::GetTokenWithPasswordCredentialsV3(const FString& ClientId
@@ -427,7 +427,7 @@ void Oauth2::GetTokenWithPasswordCredentialsV3(const FString& ClientId
 	}, TEXT(""));
 	Request->SetContentAsString(Content);
 	
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EAccelByteHttpRequestPriority::Critical);
 }
 	
 void Oauth2::VerifyAndRememberNewDevice(const FString& ClientId
@@ -457,7 +457,7 @@ void Oauth2::VerifyAndRememberNewDevice(const FString& ClientId
 	}, TEXT(""));
 	Request->SetContentAsString(Content);
 	
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EAccelByteHttpRequestPriority::Critical);
 }
 	
 void Oauth2::CreateHeadlessAccountAndResponseToken(const FString& ClientId
@@ -475,7 +475,7 @@ void Oauth2::CreateHeadlessAccountAndResponseToken(const FString& ClientId
 	FHttpRequestPtr Request = ConstructTokenRequest(Url, ClientId, ClientSecret);
 	Request->SetContentAsString(FString::Printf(TEXT("linkingToken=%s&client_id=%s"), *LinkingToken, *ClientId));
 	
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds()); 
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EAccelByteHttpRequestPriority::Critical); 
 }
 	
 void Oauth2::AuthenticationWithPlatformLink(const FString& ClientId
@@ -501,7 +501,7 @@ void Oauth2::AuthenticationWithPlatformLink(const FString& ClientId
 	}, TEXT(""));
 	Request->SetContentAsString(Content);
 	
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds());
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EAccelByteHttpRequestPriority::Critical);
 }
 	
 void Oauth2::VerifyToken(const FString& ClientId
@@ -532,7 +532,8 @@ void Oauth2::VerifyToken(const FString& ClientId
 				}
 			}),
 			OnError),
-		FPlatformTime::Seconds());
+		FPlatformTime::Seconds(),
+		EAccelByteHttpRequestPriority::Critical);
 }
 	
 void Oauth2::GenerateOneTimeCode(const FString& AccessToken
@@ -550,7 +551,7 @@ void Oauth2::GenerateOneTimeCode(const FString& AccessToken
 	Request->SetHeader(TEXT("Authorization"), TEXT("Bearer " + AccessToken));
 	Request->SetContentAsString(FString::Printf(TEXT("platformId=%s"), *PlatformId));
 	
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds()); 
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EAccelByteHttpRequestPriority::Critical); 
 }
 	
 void Oauth2::GenerateGameToken(const FString& ClientId
@@ -569,7 +570,7 @@ void Oauth2::GenerateGameToken(const FString& ClientId
 	Request->SetHeader(TEXT("cookie"), TEXT("device-token=" + FGenericPlatformHttp::UrlEncode(FAccelByteUtilities::GetDeviceId())));
 	Request->SetContentAsString(FString::Printf(TEXT("code=%s"), *Code));
 
-	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds()); 
+	FRegistry::HttpRetryScheduler.ProcessRequest(Request, CreateHttpResultHandler(OnSuccess, OnError), FPlatformTime::Seconds(), EAccelByteHttpRequestPriority::Critical); 
 }
 
 } // Namespace Api
@@ -7,6 +7,7 @@
 #include "Core/AccelByteCredentials.h"
 #include "Api/AccelByteUserApi.h"
 #include "Api/AccelByteUserProfileApi.h"
+#include "Api/AccelByteUserResolverApi.h"
 #include "Api/AccelByteCategoryApi.h"
 #include "Api/AccelByteEntitlementApi.h"
 #include "Api/AccelByteGroupApi.h"
@@ -39,6 +40,7 @@
 #include "Api/AccelByteMatchmakingV2Api.h"
 #include "Api/AccelByteHeartBeatApi.h"
 #include "Api/AccelByteStoreDisplayApi.h"
+#include "Api/AccelBytePrefetchApi.h"
 #include "GameServerApi/AccelByteServerOauth2Api.h"
 #include "GameServerApi/AccelByteServerDSMApi.h"
 #include "GameServerApi/AccelByteServerStatisticApi.h"
@@ -69,6 +71,7 @@ ServerCredentials FRegistry::ServerCredentials;
 Api::Group FRegistry::Group(FRegistry::Credentials, FRegistry::Settings, FRegistry::HttpRetryScheduler);
 Api::User FRegistry::User{FRegistry::Credentials, FRegistry::Settings, FRegistry::HttpRetryScheduler};
 Api::UserProfile FRegistry::UserProfile{FRegistry::Credentials, FRegistry::Settings, FRegistry::HttpRetryScheduler};
+Api::UserResolver FRegistry::UserResolver{FRegistry::Credentials, FRegistry::Settings, FRegistry::HttpRetryScheduler};
 Api::Category FRegistry::Category(FRegistry::Credentials, FRegistry::Settings, FRegistry::HttpRetryScheduler);
 Api::Entitlement FRegistry::Entitlement(FRegistry::Credentials, FRegistry::Settings, FRegistry::HttpRetryScheduler);
 Api::Order FRegistry::Order(FRegistry::Credentials, FRegistry::Settings, FRegistry::HttpRetryScheduler);
@@ -100,6 +103,7 @@ Api::TurnManager FRegistry::TurnManager(FRegistry::Credentials, FRegistry::Setti
 Api::HeartBeat FRegistry::HeartBeat(FRegistry::Credentials, FRegistry::Settings, FRegistry::HttpRetryScheduler);
 Api::StoreDisplay FRegistry::StoreDisplay(FRegistry::Credentials, FRegistry::Settings, FRegistry::HttpRetryScheduler);
 Api::GDPR FRegistry::GDPR(FRegistry::Credentials, FRegistry::Settings, FRegistry::HttpRetryScheduler);
+Api::Prefetch FRegistry::Prefetch(FRegistry::Credentials, FRegistry::Settings, FRegistry::HttpRetryScheduler);
 GameServerApi::ServerOauth2 FRegistry::ServerOauth2(FRegistry::ServerCredentials, FRegistry::ServerSettings, FRegistry::HttpRetryScheduler);
 GameServerApi::ServerDSM FRegistry::ServerDSM(FRegistry::ServerCredentials, FRegistry::ServerSettings, FRegistry::HttpRetryScheduler);
 GameServerApi::ServerStatistic FRegistry::ServerStatistic(FRegistry::ServerCredentials, FRegistry::ServerSettings, FRegistry::HttpRetryScheduler);
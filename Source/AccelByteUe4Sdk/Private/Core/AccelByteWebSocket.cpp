@@ -10,12 +10,22 @@
 #include "Core/AccelByteServerCredentials.h"
 #include "Core/AccelByteCredentials.h"
 #include "Core/AccelByteWebSocketErrorTypes.h"
+#include "Misc/ConfigCacheIni.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteWebsocket, Log, All);
 DEFINE_LOG_CATEGORY(LogAccelByteWebsocket);
 
 namespace AccelByte
 {	
+namespace
+{
+	// Messages are sent as UTF-8 text frames
+	int32 GetMessageSize(const FString& Message)
+	{
+		return FTCHARToUTF8(*Message).Length();
+	}
+}
+
 AccelByteWebSocket::AccelByteWebSocket(
 	const Credentials& Credentials,
 	float PingDelay,
@@ -32,6 +42,9 @@ AccelByteWebSocket::AccelByteWebSocket(
 {
 	TickerDelegate = FTickerDelegate::CreateRaw(this, &AccelByteWebSocket::Tick);
 	TickerDelegateHandle.Reset();
+	MessageTickerDelegate = FTickerDelegate::CreateRaw(this, &AccelByteWebSocket::LowLatencyMessageTick);
+	MessageTickerDelegateHandle.Reset();
+	LoadConfig();
 }
 
 AccelByteWebSocket::AccelByteWebSocket(
@@ -50,6 +63,9 @@ AccelByteWebSocket::AccelByteWebSocket(
 {
 	TickerDelegate = FTickerDelegate::CreateRaw(this, &AccelByteWebSocket::Tick);
 	TickerDelegateHandle.Reset();
+	MessageTickerDelegate = FTickerDelegate::CreateRaw(this, &AccelByteWebSocket::LowLatencyMessageTick);
+	MessageTickerDelegateHandle.Reset();
+	LoadConfig();
 }
 
 AccelByteWebSocket::~AccelByteWebSocket()
@@ -63,6 +79,41 @@ AccelByteWebSocket::~AccelByteWebSocket()
 	ServerCreds = nullptr;
 }
 
+void AccelByteWebSocket::LoadConfig()
+{
+	GConfig->GetBool(TEXT("AccelByteWebSocket"), TEXT("bLowLatencyMessageDelivery"), bLowLatencyMessageDelivery, GEngineIni);
+	GConfig->GetFloat(TEXT("AccelByteWebSocket"), TEXT("MessageTickPeriod"), MessageTickPeriod, GEngineIni);
+
+	// Slower than the state tick would only add latency
+	MessageTickPeriod = FMath::Clamp(MessageTickPeriod, 0.0f, TickPeriod);
+}
+
+void AccelByteWebSocket::StartTickers()
+{
+	StopTickers();
+
+	TickerDelegateHandle = FTickerAlias::GetCoreTicker().AddTicker(TickerDelegate, TickPeriod);
+	if (bLowLatencyMessageDelivery)
+	{
+		MessageTickerDelegateHandle = FTickerAlias::GetCoreTicker().AddTicker(MessageTickerDelegate, MessageTickPeriod);
+	}
+}
+
+void AccelByteWebSocket::StopTickers()
+{
+	if (TickerDelegateHandle.IsValid())
+	{
+		FTickerAlias::GetCoreTicker().RemoveTicker(TickerDelegateHandle);
+		TickerDelegateHandle.Reset();
+	}
+
+	if (MessageTickerDelegateHandle.IsValid())
+	{
+		FTickerAlias::GetCoreTicker().RemoveTicker(MessageTickerDelegateHandle);
+		MessageTickerDelegateHandle.Reset();
+	}
+}
+
 void AccelByteWebSocket::SetupWebSocket()
 {
 	FReport::Log(FString(__FUNCTION__));
@@ -73,6 +124,7 @@ void AccelByteWebSocket::SetupWebSocket()
 	OnMessageQueue.Empty();
 	OnConnectionClosedQueue.Empty();
 	OnConnectionErrorQueue.Empty();
+	EmptySendQueue();
 
 	if(WebSocket.IsValid())
 	{
@@ -128,6 +180,21 @@ AccelByteWebSocket::FConnectionCloseDelegate& AccelByteWebSocket::OnConnectionCl
 	return ConnectionCloseDelegate;
 }
 
+AccelByteWebSocket::FSendQueueFullDelegate& AccelByteWebSocket::OnSendQueueFull()
+{
+	return SendQueueFullDelegate;
+}
+
+AccelByteWebSocket::FMessageSupersededDelegate& AccelByteWebSocket::OnMessageSuperseded()
+{
+	return MessageSupersededDelegate;
+}
+
+AccelByteWebSocket::FMessageDroppedDelegate& AccelByteWebSocket::OnMessageDropped()
+{
+	return MessageDroppedDelegate;
+}
+
 TSharedPtr<AccelByteWebSocket, ESPMode::ThreadSafe> AccelByteWebSocket::Create(
 	const FString& Url,
 	const FString& Protocol,
@@ -199,13 +266,7 @@ void AccelByteWebSocket::Connect()
 
 	bConnectedBroadcasted = false;
 
-	if(TickerDelegateHandle.IsValid())
-	{
-		FTickerAlias::GetCoreTicker().RemoveTicker(TickerDelegateHandle);
-		TickerDelegateHandle.Reset();
-	}
-
-	TickerDelegateHandle = FTickerAlias::GetCoreTicker().AddTicker(TickerDelegate, TickPeriod);
+	StartTickers();
 
 	WebSocket->Connect();
 	WsEvents |= EWebSocketEvent::Connect;
@@ -224,11 +285,8 @@ void AccelByteWebSocket::Disconnect(bool ForceCleanup)
 	{
 		bConnectedBroadcasted = false;
 		
-		if (TickerDelegateHandle.IsValid())
-		{
-			FTickerAlias::GetCoreTicker().RemoveTicker(TickerDelegateHandle);
-			TickerDelegateHandle.Reset();
-		}
+		StopTickers();
+		EmptySendQueue();
 
 		if (WebSocket.IsValid())
 		{
@@ -256,9 +314,137 @@ void AccelByteWebSocket::SendPing() const
 	}
 }
 
-void AccelByteWebSocket::Send(const FString& Message) const
+void AccelByteWebSocket::Send(const FString& Message)
+{
+	Send(Message, FString());
+}
+
+void AccelByteWebSocket::Send(const FString& Message, const FString& CoalescingKey)
+{
+	// Nothing to wait for nor to supersede, sent right away like before the queue
+	if (SendQueueNum == 0 && IsConnected() && TryTakeSendToken())
+	{
+		WebSocket->Send(Message);
+		return;
+	}
+
+	if (!CoalescingKey.IsEmpty())
+	{
+		if (FString* QueuedMessage = QueuedMessagesByKey.Find(CoalescingKey))
+		{
+			SendQueueBytes += GetMessageSize(Message) - GetMessageSize(*QueuedMessage);
+			const FString SupersededMessage = MoveTemp(*QueuedMessage);
+			*QueuedMessage = Message;
+			UpdateSendQueueFull();
+			MessageSupersededDelegate.Broadcast(SupersededMessage);
+			return;
+		}
+		QueuedMessagesByKey.Add(CoalescingKey, Message);
+		SendQueue.Enqueue(FOutboundMessage{ FString(), CoalescingKey });
+	}
+	else
+	{
+		SendQueue.Enqueue(FOutboundMessage{ Message, FString() });
+	}
+
+	SendQueueNum++;
+	SendQueueBytes += GetMessageSize(Message);
+	UpdateSendQueueFull();
+}
+
+void AccelByteWebSocket::SetSendRateLimit(float MessagesPerSecond, int32 Burst)
+{
+	SendRateLimit = FMath::Max(MessagesPerSecond, 0.0f);
+	SendBurst = FMath::Max(Burst, 1);
+	SendTokens = SendBurst;
+	LastSendTokenTime = FPlatformTime::Seconds();
+}
+
+void AccelByteWebSocket::SetMaxQueuedSendBytes(int32 MaxBytes)
+{
+	MaxQueuedSendBytes = FMath::Max(MaxBytes, 0);
+	UpdateSendQueueFull();
+}
+
+bool AccelByteWebSocket::TryTakeSendToken()
+{
+	if (SendRateLimit <= 0.0f)
+	{
+		return true;
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	SendTokens = FMath::Min(SendTokens + (CurrentTime - LastSendTokenTime) * SendRateLimit, static_cast<double>(SendBurst));
+	LastSendTokenTime = CurrentTime;
+
+	if (SendTokens < 1.0)
+	{
+		return false;
+	}
+	SendTokens -= 1.0;
+	return true;
+}
+
+void AccelByteWebSocket::SendTick()
+{
+	// Kept queued while the connection is down, they are sent once it is connected again or dropped on disconnect
+	while (SendQueueNum > 0 && IsConnected() && TryTakeSendToken())
+	{
+		FOutboundMessage Outbound;
+		SendQueue.Dequeue(Outbound);
+		SendQueueNum--;
+
+		if (!Outbound.CoalescingKey.IsEmpty())
+		{
+			QueuedMessagesByKey.RemoveAndCopyValue(Outbound.CoalescingKey, Outbound.Message);
+		}
+		SendQueueBytes -= GetMessageSize(Outbound.Message);
+
+		WebSocket->Send(Outbound.Message);
+	}
+
+	UpdateSendQueueFull();
+}
+
+void AccelByteWebSocket::EmptySendQueue()
+{
+	TArray<FString> DroppedMessages;
+	DroppedMessages.Reserve(SendQueueNum);
+
+	FOutboundMessage Outbound;
+	while (SendQueue.Dequeue(Outbound))
+	{
+		if (!Outbound.CoalescingKey.IsEmpty())
+		{
+			QueuedMessagesByKey.RemoveAndCopyValue(Outbound.CoalescingKey, Outbound.Message);
+		}
+		DroppedMessages.Add(MoveTemp(Outbound.Message));
+	}
+
+	QueuedMessagesByKey.Empty();
+	SendQueueNum = 0;
+	SendQueueBytes = 0;
+	UpdateSendQueueFull();
+
+	// Broadcast once the queue is empty, a listener might send again
+	for (const FString& DroppedMessage : DroppedMessages)
+	{
+		MessageDroppedDelegate.Broadcast(DroppedMessage);
+	}
+}
+
+void AccelByteWebSocket::UpdateSendQueueFull()
 {
-	WebSocket->Send(Message);
+	const bool bIsFull = MaxQueuedSendBytes > 0 && SendQueueBytes > MaxQueuedSendBytes;
+	if (bIsFull != bIsSendQueueFull)
+	{
+		bIsSendQueueFull = bIsFull;
+		if (bIsFull)
+		{
+			UE_LOG(LogAccelByteWebsocket, Warning, TEXT("Outbound queue is full, %d messages and %d bytes queued"), SendQueueNum, SendQueueBytes);
+		}
+		SendQueueFullDelegate.Broadcast(bIsFull);
+	}
 }
 
 	
@@ -311,7 +497,12 @@ void AccelByteWebSocket::Reconnect()
 bool AccelByteWebSocket::Tick(float DeltaTime)
 {
 	StateTick(DeltaTime);
-	MessageTick(DeltaTime);
+
+	// Only the housekeeping is left to this tick when the messages have a ticker of their own
+	if (!MessageTickerDelegateHandle.IsValid())
+	{
+		MessageTick(DeltaTime);
+	}
 
 	if(bDisconnectOnNextTick)
 	{
@@ -432,8 +623,23 @@ bool AccelByteWebSocket::StateTick(float DeltaTime)
 	return true;
 }
 
+bool AccelByteWebSocket::LowLatencyMessageTick(float DeltaTime)
+{
+	MessageTick(DeltaTime);
+
+	if(bDisconnectOnNextTick)
+	{
+		bDisconnectOnNextTick = false;
+		Disconnect();
+	}
+
+	return true;
+}
+
 bool AccelByteWebSocket::MessageTick(float DeltaTime)
 {
+	SendTick();
+
 	if(bConnectTriggered)
 	{
 		bConnectTriggered = false;
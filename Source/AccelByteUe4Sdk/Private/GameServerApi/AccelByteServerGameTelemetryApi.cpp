@@ -19,7 +19,9 @@ ServerGameTelemetry::ServerGameTelemetry(ServerCredentials const& InCredentialsR
 	, ServerSettings const& InSettingsRef
 	, FHttpRetryScheduler& InHttpRef)
 	: FServerApiBase(InCredentialsRef, InSettingsRef, InHttpRef)
-{}
+{
+	HttpClient.SetDefaultRequestPriority(EAccelByteHttpRequestPriority::Background);
+}
 
 ServerGameTelemetry::~ServerGameTelemetry()
 {
@@ -15,6 +15,13 @@ ServerMatchmakingV2::ServerMatchmakingV2(ServerCredentials const& InCredentialsR
 	, FHttpRetryScheduler& InHttpRef)
 	: FServerApiBase(InCredentialsRef, InSettingRef, InHttpRef)
 {
+	HttpClient.SetDefaultRequestPriority(EAccelByteHttpRequestPriority::Critical);
+
+	// Backfill and match updates are time sensitive, give up early rather than retrying for a minute
+	FHttpRequestPolicy Policy;
+	Policy.Deadline = 15.0;
+	Policy.MaximumDelay = 5.0;
+	HttpClient.SetDefaultRequestPolicy(Policy);
 }
 
 ServerMatchmakingV2::~ServerMatchmakingV2()
@@ -137,6 +137,11 @@ namespace AccelByte
 			bOptionalMetricsEnabled = Enable;
 		}
 
+		void ServerMetricExporter::SetHttpCacheMetricsEnabled(bool Enable)
+		{
+			bHttpCacheMetricsEnabled = Enable;
+		}
+
 		void ServerMetricExporter::SetStatsDMetricCollector(const TSharedPtr<IAccelByteStatsDMetricCollector>& Collector)
 		{
 			StatsDMetricCollector = Collector;
@@ -159,6 +164,25 @@ namespace AccelByte
 			EnqueueMetric("FrameTimeMax", StatsDMetricCollector->GetFrameTimeMax());
 			EnqueueMetric("FameStartDelayAverage", StatsDMetricCollector->GetFrameStartDelayAverage());
 			EnqueueMetric("FrameStartDelayMax", StatsDMetricCollector->GetFrameStartDelayMax());
+
+			//HTTP Cache Metrics
+			if (bHttpCacheMetricsEnabled)
+			{
+				const Core::FAccelByteHttpCacheStats CacheStats = FRegistry::HttpRetryScheduler.GetHttpCache().GetStats();
+				EnqueueMetric("HttpCacheHit", static_cast<double>(CacheStats.HitNum));
+				EnqueueMetric("HttpCacheStaleHit", static_cast<double>(CacheStats.StaleHitNum));
+				EnqueueMetric("HttpCacheMiss", static_cast<double>(CacheStats.MissNum));
+				EnqueueMetric("HttpCacheNegativeHit", static_cast<double>(CacheStats.NegativeHitNum));
+				EnqueueMetric("HttpCacheHitRatio", CacheStats.GetHitRatio());
+				EnqueueMetric("HttpCacheNotModified", static_cast<double>(CacheStats.NotModifiedNum));
+				EnqueueMetric("HttpCacheModified", static_cast<double>(CacheStats.ModifiedNum));
+				EnqueueMetric("HttpCacheCountEviction", static_cast<double>(CacheStats.CountEvictionNum));
+				EnqueueMetric("HttpCacheSizeEviction", static_cast<double>(CacheStats.SizeEvictionNum));
+				EnqueueMetric("HttpCacheResidentBytes", static_cast<double>(CacheStats.ResidentBytes));
+				EnqueueMetric("HttpCacheAverageEntrySize", static_cast<double>(CacheStats.GetAverageEntrySize()));
+				EnqueueMetric("HttpCacheEntryCount", CacheStats.EntryNum);
+				EnqueueMetric("HttpCacheNegativeEntryCount", CacheStats.NegativeEntryNum);
+			}
 		}
 
 		bool ServerMetricExporter::ExportMetrics(float DeltaTime)
@@ -89,7 +89,9 @@ ServerOauth2::ServerOauth2(ServerCredentials& InCredentialsRef
 	, FHttpRetryScheduler& InHttpRef)
 	: FServerApiBase(InCredentialsRef, InSettingsRef, InHttpRef)
 	, ServerCredentialsRef{InCredentialsRef}
-{}
+{
+	HttpClient.SetDefaultRequestPriority(EAccelByteHttpRequestPriority::Critical);
+}
 
 ServerOauth2::~ServerOauth2()
 {}
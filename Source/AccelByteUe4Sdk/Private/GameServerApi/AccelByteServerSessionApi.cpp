@@ -20,7 +20,9 @@ ServerSession::ServerSession(ServerCredentials const& InCredentialsRef
 	, ServerSettings const& InSettingsRef
 	, FHttpRetryScheduler& InHttpRef)
 	: FServerApiBase(InCredentialsRef, InSettingsRef, InHttpRef)
-{}
+{
+	HttpClient.SetDefaultRequestPriority(EAccelByteHttpRequestPriority::Critical);
+}
 
 ServerSession::~ServerSession()
 {}
@@ -8,6 +8,7 @@
 #include "Core/AccelByteApiBase.h"
 #include "Core/AccelByteError.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteLobbyFrame.h"
 #include "Core/IAccelByteTokenGenerator.h"
 #include "Core/AccelByteWebSocket.h"
 #include "Models/AccelByteLobbyModels.h"
@@ -474,6 +475,11 @@ public:
 	*/
 	DECLARE_DELEGATE_ThreeParams(FConnectionClosed, int32 /* StatusCode */, const FString& /* Reason */, bool /* WasClean */);
 
+	/**
+	* @brief delegate for handling the outbound queue going over, or back under, its max queued bytes.
+	*/
+	DECLARE_DELEGATE_OneParam(FSendQueueFull, bool /* bIsFull */);
+
 	/**
 	 * @brief Delegate for party members changed event.
 	 */
@@ -576,6 +582,27 @@ public:
 	 * @return true if it's connected, false otherwise.
 	 */
 	bool IsConnected() const;
+
+	/**
+	 * @brief Set how long a request waits for its response before its error handler is called with
+	 * ErrorCodes::WebSocketRequestTimeout. One minute by default.
+	 */
+	void SetRequestTimeout(FTimespan Timeout);
+
+	/**
+	 * @brief Get the number of requests still waiting for their response.
+	 */
+	int32 GetPendingRequestNum() const { return PendingRequests.Num(); }
+
+	/**
+	 * @brief Get the number of requests queued behind the send rate limit.
+	 */
+	int32 GetSendQueueNum() const;
+
+	/**
+	 * @brief Get the size of the requests queued behind the send rate limit.
+	 */
+	int32 GetSendQueueBytes() const;
 	
 	/**
 	 * @brief Send ping
@@ -637,6 +664,7 @@ public:
 
 	/**
 	 * @brief Set presence status on lobby service
+	 * A newer status replaces one that is still queued, whose error handler is called with ErrorCodes::WebSocketRequestSuperseded.
 	 *
 	 * @param Availability Presence state that you want to use. State is EAvailability type
 	 * @param Activity User's custom activity
@@ -995,6 +1023,7 @@ public:
 
 	/**
 	 * @brief Set user attribute to lobby session. 
+	 * A newer value of the same key replaces one that is still queued, whose error handler is called with ErrorCodes::WebSocketRequestSuperseded.
 	 *
 	 * @param Key the attribute's key.
 	 * @param Value the attribute's value.
@@ -1135,6 +1164,15 @@ public:
 	{
 		Reconnecting = OnReconnecting;
 	}
+
+	/**
+	 * @brief Set a trigger function when the outbound queue goes over its max queued bytes, and when it is back under it.
+	 * The requests are still sent, this is a signal to slow down.
+	 */
+	void SetSendQueueFullDelegate(const FSendQueueFull& OnSendQueueFull)
+	{
+		SendQueueFull = OnSendQueueFull;
+	}
 	
 	/**
 	 * @brief Set a trigger function when a party member leave from the party. This function is DEPRECATED
@@ -2338,17 +2376,18 @@ private:
 
     FString SendRawRequest(const FString& MessageType
     	, const FString& MessageIDPrefix
-    	, const FString& CustomPayload = TEXT(""));
+    	, const FString& CustomPayload = TEXT("")
+    	, const FString& CoalescingKey = TEXT(""));
+
+	void OnMessageSuperseded(const FString& Message);
+	void OnMessageDropped(const FString& Message);
 	
-    FString GenerateMessageID(const FString& Prefix = TEXT("")) const;
+    FString GenerateMessageID(const FString& Prefix = TEXT(""));
 	
 	void CreateWebSocket(const FString& Token = "");
 	
 	void FetchLobbyErrorMessages();
 	
-	bool ExtractLobbyMessageMetaData(const FString& InLobbyMessage
-		, TSharedRef<FLobbyMessageMetaData>& OutLobbyMessageMetaData);
-	
 	THandler<const FString&> OnTokenReceived = THandler<const FString&>::CreateLambda([&](const FString& Token)
 	{
 		Connect(Token);
@@ -2356,15 +2395,12 @@ private:
 
 #pragma region Message Parsing
 	void HandleMessageResponse(const FString& ReceivedMessageType
-		, const FString& ParsedJsonString
-		, const TSharedPtr<FJsonObject>& ParsedJsonObj
-		, const TSharedPtr<FLobbyMessageMetaData>& MessageMeta);
+		, const FAccelByteLobbyFrame& Frame);
 	
 	void HandleMessageNotif(const FString& ReceivedMessageType
-		, const FString& ParsedJsonString
-		, const TSharedPtr<FJsonObject>& ParsedJsonObj);
+		, const FAccelByteLobbyFrame& Frame);
 	
-	void HandleV2SessionNotif(const FString& ParsedJsonString);
+	void HandleV2SessionNotif(const FAccelByteLobbyFrame& Frame);
 	
 	void HandleV2MatchmakingNotif(const FAccelByteModelsNotificationMessage& Message);
 
@@ -2397,6 +2433,7 @@ private:
 	FDisconnectNotif DisconnectNotif;
 	FConnectionClosed ConnectionClosed;
 	FConnectionClosed Reconnecting;
+	FSendQueueFull SendQueueFull;
 	TSharedPtr<IAccelByteTokenGenerator> TokenGenerator;
 
 	FDelegateHandle TokenRefreshDelegateHandle;
@@ -2422,65 +2459,33 @@ private:
 	TMap<FString, FUnbanScheduleRef> UnbanSchedules;
 #pragma endregion
 
-#pragma region Message Id - Response Map
-	TMap<FString, FPartyInfoResponse> MessageIdPartyInfoResponseMap;
-	TMap<FString, FPartyCreateResponse> MessageIdPartyCreateResponseMap;
-	TMap<FString, FPartyLeaveResponse> MessageIdPartyLeaveResponseMap;
-	TMap<FString, FPartyInviteResponse> MessageIdPartyInviteResponseMap;
-	TMap<FString, FPartyJoinResponse> MessageIdPartyJoinResponseMap;
-	TMap<FString, FPartyRejectResponse> MessageIdPartyRejectResponseMap;
-	TMap<FString, FPartyKickResponse> MessageIdPartyKickResponseMap;
-	TMap<FString, FPartyGenerateCodeResponse> MessageIdPartyGenerateCodeResponseMap;
-	TMap<FString, FPartyGetCodeResponse> MessageIdPartyGetCodeResponseMap;
-	TMap<FString, FPartyDeleteCodeResponse> MessageIdPartyDeleteCodeResponseMap;
-	TMap<FString, FPartyJoinViaCodeResponse> MessageIdPartyJoinViaCodeResponseMap;
-	TMap<FString, FPartyPromoteLeaderResponse> MessageIdPartyPromoteLeaderResponseMap;
-	TMap<FString, FPartySendNotifResponse> MessageIdPartySendNotifResponseMap;
-
-	// Chat
-	TMap<FString, FPersonalChatResponse> MessageIdPersonalChatResponseMap;
-	TMap<FString, FPartyChatResponse> MessageIdPartyChatResponseMap;
-	TMap<FString, FJoinDefaultChannelChatResponse> MessageIdJoinDefaultChannelChatResponseMap;
-	TMap<FString, FChannelChatResponse> MessageIdChannelChatResponseMap;
+#pragma region Pending Requests
+	struct FPendingRequest
+	{
+		FString ResponseType;
+		double Deadline{0.0};
 
-	// Presence
-	TMap<FString, FSetUserPresenceResponse> MessageIdSetUserPresenceResponseMap;
-	TMap<FString, FGetAllFriendsStatusResponse> MessageIdGetAllFriendsStatusResponseMap;
+		// Decodes the response and calls the response delegate captured when the request was sent, or the error handler
+		TFunction<void(const FAccelByteLobbyFrame& Frame, const FString& ReceivedMessageType, int32 ResponseCode)> Respond;
 
-	// Matchmaking
-	TMap<FString, FMatchmakingResponse> MessageIdMatchmakingStartResponseMap;
-	TMap<FString, FMatchmakingResponse> MessageIdMatchmakingCancelResponseMap;
-	TMap<FString, FReadyConsentResponse> MessageIdReadyConsentResponseMap;
-	TMap<FString, FRejectConsentResponse> MessageIdRejectConsentResponseMap;
+		// Calls the error handler of the request when it is never answered
+		TFunction<void(int32 ErrorCode)> Expire;
+	};
 
-	// Custom Game
-	TMap<FString, FBaseResponse> MessageIdCreateDSResponseMap;
+	void AddPendingRequest(const FString& MessageId
+		, const FString& ResponseType
+		, TFunction<void(const FAccelByteLobbyFrame& Frame, const FString& ReceivedMessageType, int32 ResponseCode)>&& Respond
+		, TFunction<void(int32 ErrorCode)>&& Expire);
 
-	// Friends
-	TMap<FString, FRequestFriendsResponse> MessageIdRequestFriendsResponseMap;
-	TMap<FString, FRequestFriendsResponse> MessageIdRequestFriendsByPublicIdResponseMap;
-	TMap<FString, FUnfriendResponse> MessageIdUnfriendResponseMap;
-	TMap<FString, FListOutgoingFriendsResponse> MessageIdListOutgoingFriendsResponseMap;
-	TMap<FString, FListOutgoingFriendsWithTimeResponse> MessageIdListOutgoingFriendsWithTimeResponseMap;
-	TMap<FString, FCancelFriendsResponse> MessageIdCancelFriendsResponseMap;
-	TMap<FString, FListIncomingFriendsResponse> MessageIdListIncomingFriendsResponseMap;
-	TMap<FString, FListIncomingFriendsWithTimeResponse> MessageIdListIncomingFriendsWithTimeResponseMap;
-	TMap<FString, FAcceptFriendsResponse> MessageIdAcceptFriendsResponseMap;
-	TMap<FString, FRejectFriendsResponse> MessageIdRejectFriendsResponseMap;
-	TMap<FString, FLoadFriendListResponse> MessageIdLoadFriendListResponseMap;
-	TMap<FString, FGetFriendshipStatusResponse> MessageIdGetFriendshipStatusResponseMap;
+	bool SweepPendingRequests(float DeltaTime);
 
-	// Block
-	TMap<FString, FBlockPlayerResponse> MessageIdBlockPlayerResponseMap;
-	TMap<FString, FUnblockPlayerResponse> MessageIdUnblockPlayerResponseMap;
-	TMap<FString, FListBlockedUserResponse> MessageIdListBlockedUserResponseMap;
-	TMap<FString, FListBlockerResponse> MessageIdListBlockerResponseMap;
+	void ClearPendingRequests();
 
-	//Session Attribute
-	TMap<FString, FSetSessionAttributeResponse> MessageIdSetSessionAttributeResponseMap;
-	TMap<FString, FGetSessionAttributeResponse> MessageIdGetSessionAttributeResponseMap;
-	TMap<FString, FGetAllSessionAttributeResponse> MessageIdGetAllSessionAttributeResponseMap;
-	TMap<FString, FRefreshTokenResponse> MessageIdRefreshTokenResponseMap;
+	// The requests waiting for their response by message id, the only place their response delegates are kept
+	TMap<FString, FPendingRequest> PendingRequests;
+	uint64 LastMessageId{0};
+	FTimespan RequestTimeout = FTimespan(0, 1, 0);
+	FDelegateHandleAlias PendingRequestSweepHandle;
 #pragma endregion
 
 #pragma region Response/Notif Delegates
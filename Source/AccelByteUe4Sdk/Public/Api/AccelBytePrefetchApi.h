@@ -0,0 +1,111 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/AccelByteApiBase.h"
+#include "Core/AccelByteHttpRetryScheduler.h"
+#include "Models/AccelBytePrefetchModels.h"
+
+namespace AccelByte
+{
+class Credentials;
+class Settings;
+namespace Api
+{
+
+/**
+ * @brief Warm up the HTTP cache after login by sending the requests of a manifest at once, at background priority.
+ * The API calls made afterward with the same URL are served from the cache, so the time to be interactive
+ * after login is the longest round trip instead of their sum.
+ *
+ * Disabled by default. It is configured in DefaultEngine.ini, or through code before login:
+ * [AccelBytePrefetch]
+ * bPrefetchOnLogin=true
+ * ; Entries replace the default manifest, one Name=Url per line
+ * +Entries=Stores={platformServerUrl}/public/namespaces/{namespace}/stores
+ *
+ * The responses are only kept if the HTTP cache is enabled and they are cacheable.
+ */
+class ACCELBYTEUE4SDK_API Prefetch : public FApiBase
+{
+public:
+	Prefetch(Credentials& InCredentialsRef, Settings const& InSettingsRef, FHttpRetryScheduler& InHttpRef);
+	~Prefetch();
+
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnWarmDelegate, const FAccelByteModelsPrefetchWarmEvent& /*Event*/);
+
+	/**
+	 * @brief Requests matching the default arguments of StoreDisplay::GetAllViews, Item::GetListAllStores,
+	 * Entitlement::QueryUserEntitlements (limit 20), Statistic::GetMyStatItems, Achievement::QueryAchievements
+	 * and Agreement::QueryLegalEligibilities.
+	 */
+	static TArray<FAccelByteModelsPrefetchEntry> GetDefaultManifest();
+
+	/**
+	 * @brief Replace the manifest, the configured one is not loaded anymore.
+	 */
+	void SetManifest(TArray<FAccelByteModelsPrefetchEntry> const& InManifest);
+
+	TArray<FAccelByteModelsPrefetchEntry> const& GetManifest();
+
+	/**
+	 * @brief Enable or disable the prefetch on login success, overriding the configuration.
+	 */
+	void SetPrefetchOnLogin(bool bEnabled);
+
+	/**
+	 * @brief Stop running the manifest on login success, e.g. another instance already does it for the same credentials.
+	 * Run can still be called directly.
+	 */
+	void UnbindLoginSuccess();
+
+	/**
+	 * @brief Send every request of the manifest now. The user should be logged in first.
+	 *
+	 * @return false if the user is not logged in, a prefetch is already running or the manifest is empty
+	 */
+	bool Run();
+
+	/**
+	 * @brief Called once every request of a prefetch got its response.
+	 */
+	FOnWarmDelegate& OnWarm() { return WarmDelegate; }
+
+private:
+	Prefetch() = delete;
+	Prefetch(Prefetch const&) = delete;
+	Prefetch(Prefetch&&) = delete;
+
+	/**
+	 * @brief Progress of a single prefetch, shared with the response handlers
+	 */
+	struct FRun
+	{
+		double StartTime{0.0};
+		int32 PendingNum{0};
+		FAccelByteModelsPrefetchWarmEvent Event{};
+	};
+
+	void LoadConfig();
+	void OnLoginSuccess(FOauth2Token const& Response);
+	void OnEntryFinished(TSharedRef<FRun> const& Run, int32 Index, bool bSucceeded, int32 ErrorCode);
+	FString FormatEntryUrl(FString const& Url) const;
+
+	Credentials& CredentialsRef;
+
+	bool bIsConfigLoaded{false};
+	bool bPrefetchOnLogin{false};
+	TArray<FAccelByteModelsPrefetchEntry> Manifest;
+	TSharedPtr<FRun> CurrentRun;
+	FOnWarmDelegate WarmDelegate;
+
+	// Released on destruction so the handlers of the pending requests don't touch this object
+	TSharedPtr<bool> bValidityFlagPtr = nullptr;
+	FDelegateHandle LoginSuccessHandle;
+};
+
+} // Namespace Api
+} // Namespace AccelByte
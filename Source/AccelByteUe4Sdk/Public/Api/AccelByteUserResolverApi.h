@@ -0,0 +1,119 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/AccelByteApiBase.h"
+#include "Core/AccelByteError.h"
+#include "Core/AccelByteHttpRetryScheduler.h"
+#include "Core/AccelByteDefines.h"
+#include "Models/AccelByteUserModels.h"
+
+namespace AccelByte
+{
+class Credentials;
+class Settings;
+namespace Api
+{
+
+/**
+ * @brief Resolve the basic info of users one ID at a time, e.g. per scoreboard row or chat sender, with as few requests as possible.
+ * The IDs requested within a batch window are deduplicated and resolved together with the bulk user info endpoint,
+ * and the results are kept in memory for a while. The user should be logged in first.
+ * To be used from the game thread.
+ */
+class ACCELBYTEUE4SDK_API UserResolver : public FApiBase
+{
+public:
+	UserResolver(Credentials& InCredentialsRef, Settings const& InSettingsRef, FHttpRetryScheduler& InHttpRef);
+	~UserResolver();
+
+	/**
+	 * @brief Get the basic info of a user, from the cache or batched with the other IDs requested within the window.
+	 * The handlers are called right away if the user is cached.
+	 *
+	 * @param UserId Id of the user.
+	 * @param OnSuccess This will be called when the operation succeeded. The result is FBaseUserInfo.
+	 * @param OnError This will be called when the operation failed, with 404 if the user doesn't exist.
+	 */
+	void GetUserInfo(FString const& UserId
+		, THandler<FBaseUserInfo> const& OnSuccess
+		, FErrorHandler const& OnError);
+
+	/**
+	 * @brief Get the basic info of several users, batched the same way as GetUserInfo.
+	 *
+	 * @param UserIds Ids of the users.
+	 * @param OnSuccess This will be called once every user is resolved, the users that don't exist are left out.
+	 * @param OnError This will be called if any of the batches failed.
+	 */
+	void GetUserInfos(TArray<FString> const& UserIds
+		, THandler<FListBulkUserInfo> const& OnSuccess
+		, FErrorHandler const& OnError);
+
+	/**
+	 * @brief Set how long the requested IDs are collected before they are sent.
+	 * Zero, the default, sends them on the next tick.
+	 */
+	void SetBatchWindow(FTimespan Window);
+
+	/**
+	 * @brief Set the maximum number of IDs sent in a single request, the larger batches are split.
+	 */
+	void SetMaxBatchSize(int32 MaxBatchSize);
+
+	/**
+	 * @brief Set how long a resolved user is served from memory. Zero disables the cache.
+	 */
+	void SetCacheTtl(FTimespan Ttl);
+
+	/**
+	 * @brief Drop every cached user, the requests in flight are not affected.
+	 */
+	void ClearCache();
+
+private:
+	UserResolver() = delete;
+	UserResolver(UserResolver const&) = delete;
+	UserResolver(UserResolver&&) = delete;
+
+	struct FWaiter
+	{
+		THandler<FBaseUserInfo> OnSuccess;
+		FErrorHandler OnError;
+	};
+
+	struct FCachedUser
+	{
+		FBaseUserInfo Info;
+		double ExpireTime{0.0};
+	};
+
+	bool FlushPendingIds(float DeltaTime);
+	void SendBatch(TArray<FString> const& UserIds);
+	void OnBatchSucceeded(TArray<FString> const& UserIds, FListBulkUserInfo const& Result);
+	void OnBatchFailed(TArray<FString> const& UserIds, int32 ErrorCode, FString const& ErrorMessage);
+	void OnLoginSuccess(FOauth2Token const& Response);
+
+	Credentials& CredentialsRef;
+
+	FTimespan BatchWindow = FTimespan::Zero();
+	int32 MaxBatchSize = 100;
+	FTimespan CacheTtl = FTimespan(0, 5, 0);
+
+	// Waiters of each ID, either pending for the next batch or in flight
+	TMap<FString, TArray<FWaiter>> Waiters;
+	TArray<FString> PendingIds;
+	TMap<FString, FCachedUser> CachedUsers;
+
+	FDelegateHandleAlias FlushTickDelegateHandle;
+	FDelegateHandle LoginSuccessHandle;
+
+	// Released on destruction so the handlers of the pending requests don't touch this object
+	TSharedPtr<bool> bValidityFlagPtr = nullptr;
+};
+
+} // Namespace Api
+} // Namespace AccelByte
@@ -26,6 +26,7 @@
 #include "Api/AccelByteMiscellaneousApi.h"
 #include "Api/AccelByteOrderApi.h"
 #include "Api/AccelBytePresenceBroadcastEventApi.h"
+#include "Api/AccelBytePrefetchApi.h"
 #include "Api/AccelByteQos.h"
 #include "Api/AccelByteQosManagerApi.h"
 #include "Api/AccelByteReportingApi.h"
@@ -37,6 +38,7 @@
 #include "Api/AccelByteUGCApi.h"
 #include "Api/AccelByteUserApi.h"
 #include "Api/AccelByteUserProfileApi.h"
+#include "Api/AccelByteUserResolverApi.h"
 #include "Api/AccelByteWalletApi.h"
 #include "Api/AccelByteSessionApi.h"
 #include "Api/AccelByteMatchmakingV2Api.h"
@@ -61,6 +63,7 @@ public:
 	Api::Group Group{*CredentialsRef, FRegistry::Settings, *HttpRef};
 	Api::User User{*CredentialsRef, FRegistry::Settings, *HttpRef};
 	Api::UserProfile UserProfile{*CredentialsRef, FRegistry::Settings, *HttpRef};
+	Api::UserResolver UserResolver{*CredentialsRef, FRegistry::Settings, *HttpRef};
 	Api::Category Category{*CredentialsRef, FRegistry::Settings, *HttpRef};
 	Api::Entitlement Entitlement{*CredentialsRef, FRegistry::Settings, *HttpRef};
 	Api::Order Order{*CredentialsRef, FRegistry::Settings, *HttpRef};
@@ -92,6 +95,7 @@ public:
 	Api::StoreDisplay StoreDisplay{*CredentialsRef, FRegistry::Settings, *HttpRef};
 	Api::GDPR GDPR{*CredentialsRef, FRegistry::Settings, *HttpRef};
 	Api::PresenceBroadcastEvent PresenceBroadcastEvent{*CredentialsRef, FRegistry::Settings, *HttpRef};
+	Api::Prefetch Prefetch{*CredentialsRef, FRegistry::Settings, *HttpRef};
 	
 	template<typename T, typename... U>
 	T GetApi(U&&... Args)
@@ -0,0 +1,169 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Models/AccelByteGeneralModels.h"
+
+namespace AccelByte
+{
+namespace Core
+{
+
+/**
+ * @brief Compact binary conversion of a cached item, used by the storages that don't keep the object itself.
+ * Only the types with a specialization below can be stored.
+ */
+template <typename T>
+struct TAccelByteCacheItemSerializer
+{
+	/**
+	 * @param bIsPersistent The bytes outlive the session, time is written as UTC instead of platform time.
+	 */
+	static bool Serialize(T& Item, TArray<uint8>& OutBytes, bool bIsPersistent = false) { return false; }
+	static TSharedPtr<T> Deserialize(const TArray<uint8>& Bytes, bool bIsPersistent = false) { return nullptr; }
+};
+
+#pragma region OVERRIDE_FString
+template<>
+struct TAccelByteCacheItemSerializer<FString>
+{
+	static bool Serialize(FString& Item, TArray<uint8>& OutBytes, bool bIsPersistent = false)
+	{
+		FMemoryWriter Writer(OutBytes);
+		Writer << Item;
+		return !Writer.IsError();
+	}
+
+	static TSharedPtr<FString> Deserialize(const TArray<uint8>& Bytes, bool bIsPersistent = false)
+	{
+		TSharedPtr<FString> Output = MakeShared<FString>();
+		FMemoryReader Reader(Bytes);
+		Reader << *Output;
+		return Reader.IsError() ? nullptr : Output;
+	}
+};
+#pragma endregion
+
+// Override specific for AccelByteHttpCacheUsage, only the serialized request and response are written
+#pragma region OVERRIDE_FAccelByteHttpCacheItem
+template<>
+struct TAccelByteCacheItemSerializer<FAccelByteHttpCacheItem>
+{
+	static bool Serialize(FAccelByteHttpCacheItem& Item, TArray<uint8>& OutBytes, bool bIsPersistent = false)
+	{
+		FAccelByteLRUHttpStruct Struct = Item.SerializableRequestAndResponse;
+		const FHttpRequestPtr RequestPtr = Item.Request;
+		if (RequestPtr.IsValid() && RequestPtr->GetResponse().IsValid())
+		{
+			Struct.SetMember(
+				RequestPtr->GetAllHeaders(),
+				RequestPtr->GetResponse()->GetAllHeaders(),
+				RequestPtr->GetResponse()->GetResponseCode(),
+				RequestPtr->GetURL(),
+				RequestPtr->GetResponse()->GetContent(),
+				Item.ExpireTime);
+		}
+		else if (Struct.RequestURL.IsEmpty())
+		{
+			return false;
+		}
+
+		double ExpireTime = Item.ExpireTime;
+		if (bIsPersistent)
+		{
+			ExpireTime += FDateTime::UtcNow().ToUnixTimestamp() - FPlatformTime::Seconds();
+		}
+
+		FMemoryWriter Writer(OutBytes);
+		Writer << ExpireTime;
+		SerializePolicy(Writer, Item.Policy);
+		Writer << Struct.RequestHeaders;
+		Writer << Struct.ResponseHeaders;
+		Writer << Struct.ResponseCode;
+		Writer << Struct.RequestURL;
+		Writer << Struct.ResponsePayload;
+		return !Writer.IsError();
+	}
+
+	static TSharedPtr<FAccelByteHttpCacheItem> Deserialize(const TArray<uint8>& Bytes, bool bIsPersistent = false)
+	{
+		TSharedPtr<FAccelByteHttpCacheItem> Output = MakeShared<FAccelByteHttpCacheItem>();
+		FAccelByteLRUHttpStruct& Struct = Output->SerializableRequestAndResponse;
+
+		FMemoryReader Reader(Bytes);
+		Reader << Output->ExpireTime;
+		SerializePolicy(Reader, Output->Policy);
+		Reader << Struct.RequestHeaders;
+		Reader << Struct.ResponseHeaders;
+		Reader << Struct.ResponseCode;
+		Reader << Struct.RequestURL;
+		Reader << Struct.ResponsePayload;
+		if (Reader.IsError())
+		{
+			return nullptr;
+		}
+
+		if (bIsPersistent)
+		{
+			Output->ExpireTime -= FDateTime::UtcNow().ToUnixTimestamp() - FPlatformTime::Seconds();
+		}
+		Struct.ExpireTime = FString::SanitizeFloat(Output->ExpireTime);
+
+		// Like the file cache, the response can't be rebuilt, the handlers read the serialized payload instead
+		FHttpRequestPtr Request = MakeShareable<IHttpRequest>(FGenericPlatformHttp::ConstructRequest());
+		Request->SetURL(Struct.RequestURL);
+		for (const FString& HeaderAndValue : Struct.RequestHeaders)
+		{
+			FString Header, Value;
+			if (HeaderAndValue.Split(TEXT(":"), &Header, &Value))
+			{
+				Request->SetHeader(Header.TrimStartAndEnd(), Value.TrimStartAndEnd());
+			}
+		}
+		Output->Request = Request;
+
+		return Output;
+	}
+
+private:
+	static void SerializePolicy(FArchive& Ar, FAccelByteHttpCachePolicy& Policy)
+	{
+		uint8 Flags = 0;
+		if (Ar.IsSaving())
+		{
+			Flags = static_cast<uint8>(Policy.bHasCacheControl | Policy.bNoCache << 1 | Policy.bNoStore << 2 | Policy.bMustRevalidate << 3
+				| Policy.bImmutable << 4 | Policy.bPrivate << 5 | Policy.bPublic << 6);
+		}
+
+		Ar << Policy.MaxAge;
+		Ar << Policy.Age;
+		Ar << Policy.ExpiresIn;
+		Ar << Policy.StaleWhileRevalidate;
+		Ar << Policy.StaleIfError;
+		Ar << Flags;
+		Ar << Policy.ETag;
+
+		if (Ar.IsLoading())
+		{
+			Policy.bHasCacheControl = (Flags & 1) != 0;
+			Policy.bNoCache = (Flags >> 1 & 1) != 0;
+			Policy.bNoStore = (Flags >> 2 & 1) != 0;
+			Policy.bMustRevalidate = (Flags >> 3 & 1) != 0;
+			Policy.bImmutable = (Flags >> 4 & 1) != 0;
+			Policy.bPrivate = (Flags >> 5 & 1) != 0;
+			Policy.bPublic = (Flags >> 6 & 1) != 0;
+		}
+	}
+};
+#pragma endregion
+
+}
+}
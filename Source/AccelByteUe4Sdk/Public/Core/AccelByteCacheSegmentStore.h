@@ -0,0 +1,162 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Misc/Guid.h"
+
+class IFileHandle;
+class IMappedFileHandle;
+
+namespace AccelByte
+{
+namespace Core
+{
+
+/**
+ * @brief Persistent key value store backed by a single append-only segment file and a binary index file.
+ *
+ * Every write and removal is appended to the segment as a checksummed record. The index is a snapshot of the
+ * live records written on flush, at startup it is loaded and only the records appended after the snapshot
+ * are scanned. A torn or corrupted tail left by a crash is dropped by rewriting the live records.
+ * The segment is rewritten as well once the dead records take more than half of it, on a background thread
+ * from a snapshot of the index, the records appended in the meantime are carried over once it is done.
+ * The appended records are flushed in batches, on Flush and at most every few seconds while writing.
+ * Values are read through a memory mapping of the segment when the platform supports it.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteCacheSegmentStore
+{
+public:
+	struct FRecoveredEntry
+	{
+		FString Key;
+		int64 Size = 0;
+	};
+
+	FAccelByteCacheSegmentStore(const FString& InDirectory, const FString& InName);
+	~FAccelByteCacheSegmentStore();
+
+	FAccelByteCacheSegmentStore(const FAccelByteCacheSegmentStore&) = delete;
+	FAccelByteCacheSegmentStore& operator=(const FAccelByteCacheSegmentStore&) = delete;
+
+	/**
+	 * @brief Open the files and recover the entries of the previous session.
+	 *
+	 * @param OutEntries Recovered entries, from the oldest to the latest written.
+	 * @return false if the segment can't be opened for writing.
+	 */
+	bool Open(TArray<FRecoveredEntry>& OutEntries);
+
+	/**
+	 * @brief Wait for the background compaction, write the index and release the file handles.
+	 */
+	void Close();
+
+	/**
+	 * @brief Flush the appended records and write the index snapshot so the next startup only scans what is appended after it.
+	 */
+	bool Flush();
+
+	bool Put(const FString& Key, const TArray<uint8>& Value);
+	bool Get(const FString& Key, TArray<uint8>& OutValue);
+	bool Remove(const FString& Key);
+	bool Contains(const FString& Key) const { return Index.Contains(Key); }
+
+	/**
+	 * @brief Delete every entry and start a new empty segment.
+	 */
+	void Clear();
+
+	/**
+	 * @brief Rewrite the live records into a new segment right away, dropping the removed and replaced ones.
+	 */
+	bool Compact();
+
+	bool IsOpen() const { return Writer != nullptr; }
+	int32 GetEntryNum() const { return Index.Num(); }
+	int64 GetSegmentSize() const { return SegmentSize; }
+	int64 GetLiveBytes() const { return LiveBytes; }
+
+private:
+	enum class ERecordType : uint8
+	{
+		Put = 1,
+		Remove = 2
+	};
+
+	struct FIndexEntry
+	{
+		// Offset of the record in the segment
+		int64 Offset = 0;
+		int32 KeySize = 0;
+		int32 ValueSize = 0;
+
+		int64 GetRecordSize() const;
+		int64 GetValueOffset() const;
+	};
+
+	struct FCompaction
+	{
+		FGuid Generation;
+		// Segment size when the index snapshot was taken, the records after it are carried over on finishing
+		int64 SnapshotSize = 0;
+		TMap<FString, FIndexEntry> Index;
+		int64 Size = 0;
+		bool bIsSucceeded = false;
+	};
+
+	static constexpr uint32 SegmentMagic = 0x53434241; // ABCS
+	static constexpr uint32 IndexMagic = 0x49434241; // ABCI
+	static constexpr uint32 RecordMagic = 0x52434241; // ABCR
+	static constexpr uint32 Version = 1;
+	static constexpr int64 SegmentHeaderSize = sizeof(uint32) * 2 + sizeof(FGuid);
+	static constexpr int64 RecordHeaderSize = sizeof(uint32) * 4 + sizeof(uint8);
+	static constexpr int32 MaxKeySize = 64 * 1024;
+	static constexpr int32 MaxValueSize = 64 * 1024 * 1024;
+	static constexpr int64 CompactionMinSegmentSize = 1024 * 1024;
+	static constexpr int64 CarryOverChunkSize = 1024 * 1024;
+	static constexpr double WriterFlushInterval = 5.0;
+
+	static bool CreateSegment(const FString& Path, const FGuid& InGeneration, IFileHandle*& OutHandle);
+	static void WriteCompactedSegment(const FString& SourcePath, const FString& TempPath, const TArray<TPair<FString, FIndexEntry>>& Entries, FCompaction& OutCompaction);
+	bool ReadSegmentHeader(IFileHandle& Handle, FGuid& OutGeneration) const;
+	bool LoadIndex();
+	bool ScanSegment(IFileHandle& Handle, int64 From, bool& bOutIsTornTail);
+	static bool AppendRecord(IFileHandle& Handle, int64& InOutSize, ERecordType Type, const FTCHARToUTF8& Key, const uint8* Value, int32 ValueSize, FIndexEntry* OutEntry);
+	bool ReadValue(const FIndexEntry& Entry, TArray<uint8>& OutValue);
+	void ReleaseReaders();
+	void CompactIfNeeded();
+	void StartCompaction();
+	bool FinishCompaction(const FCompaction& Compaction);
+	void AbandonCompaction();
+	bool ReplaceSegment(const FString& TempPath, const FGuid& NewGeneration, TMap<FString, FIndexEntry>&& NewIndex, int64 NewSize, int64 NewLiveBytes);
+	void FlushWriter();
+	void FlushWriterIfNeeded();
+
+	FString SegmentPath;
+	FString IndexPath;
+
+	FGuid Generation;
+	TMap<FString, FIndexEntry> Index;
+	int64 SegmentSize = 0;
+	int64 LiveBytes = 0;
+
+	// Offset up to where the index file describes the segment
+	int64 FlushedSize = 0;
+	// Offset up to where the appended records are flushed to the file
+	int64 WriterFlushedSize = 0;
+	double LastWriterFlushTime = 0.0;
+
+	TFuture<FCompaction> CompactionTask;
+
+	IFileHandle* Writer = nullptr;
+	IFileHandle* Reader = nullptr;
+	IMappedFileHandle* MappedSegment = nullptr;
+	bool bIsMappingSupported = true;
+};
+
+}
+}
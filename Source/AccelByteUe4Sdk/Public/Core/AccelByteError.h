@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "Http.h"
 #include "JsonUtilities.h"
+#include "Async/Async.h"
 #include "Runtime/Launch/Resources/Version.h"
 
 #include <unordered_map>
@@ -15,6 +16,7 @@
 #include "Models/AccelByteErrorModels.h"
 #include "Core/AccelByteHttpRetryScheduler.h"
 #include "Core/AccelByteHttpCache.h"
+#include "Core/AccelByteHttpResponseDecoder.h"
 #include "Core/AccelByteTypeConverter.h"
 #include "AccelByteError.generated.h"
 
@@ -367,7 +369,11 @@ namespace AccelByte
 		InvalidResponse = 14004,
 		NetworkError = 14005,
 		IsNotLoggedIn = 14006,
+		CircuitBreakerOpen = 14007,
 		WebSocketConnectFailed = 14201,
+		WebSocketRequestTimeout = 14202,
+		WebSocketRequestNotSent = 14203,
+		WebSocketRequestSuperseded = 14204,
 		CachedTokenNotFound = 14301,
 		UnableToSerializeCachedToken = 14302,
 		CachedTokenExpired = 14303,
@@ -414,6 +420,12 @@ namespace AccelByte
 	
 	ACCELBYTEUE4SDK_API void HandleHttpOAuthError(FHttpRequestPtr Request, FHttpResponsePtr Response, int& OutCode, FString& OutMessage, FErrorOAuthInfo& OutErrorInfo);
 
+	/**
+	 * @brief Get the error for a request that finished without being sent.
+	 * Defaults to NetworkError unless the scheduler rejected the request with a specific reason (e.g. open circuit breaker).
+	 */
+	ACCELBYTEUE4SDK_API void HandleHttpRequestNotSent(FHttpRequestPtr Request, int& OutCode, FString& OutMessage);
+
 	inline bool HandleHttpResultOk(FHttpResponsePtr Response, TArray<uint8> Payload, const FVoidHandler& OnSuccess)
 	{
 		OnSuccess.ExecuteIfBound();
@@ -511,14 +523,103 @@ namespace AccelByte
 		return bSuccess;
 	}
 
+	/**
+	 * @brief Whether a success handler result can be decoded on a worker thread, i.e. a plain USTRUCT model.
+	 * Models with a custom decoder in HandleHttpResultOk must opt out.
+	 */
+	template<typename T, typename = void>
+	struct TIsHttpResultAsyncDecodable
+	{
+		static constexpr bool Value = false;
+	};
+
+	template<typename T>
+	struct TIsHttpResultAsyncDecodable<T, decltype(void(T::StaticStruct()))>
+	{
+		static constexpr bool Value = true;
+	};
+
+	template<>
+	struct TIsHttpResultAsyncDecodable<FAccelByteModelsPartyDataNotif>
+	{
+		static constexpr bool Value = false;
+	};
+
+	/**
+	 * @brief Decode the response on a worker thread then execute the handler on the game thread.
+	 *
+	 * @return false if the handler type doesn't support async decoding, the response should be handled by HandleHttpResultOk.
+	 */
+	template<typename THandlerType>
+	inline bool HandleHttpResultOkAsync(FHttpResponsePtr Response, const THandlerType& OnSuccess, const FSimpleDelegate& OnInvalidResponse)
+	{
+		return false;
+	}
+
+	template<typename T>
+	inline typename TEnableIf<TIsHttpResultAsyncDecodable<T>::Value, bool>::Type HandleHttpResultOkAsync(FHttpResponsePtr Response, const THandler<T>& OnSuccess, const FSimpleDelegate& OnInvalidResponse)
+	{
+		FHttpResponseDecoder::Launch([Response, OnSuccess, OnInvalidResponse]() mutable
+			{
+				T Result;
+				const bool bSuccess = FAccelByteJsonConverter::JsonObjectStringToUStruct(Response->GetContentAsString(), &Result);
+
+				// Only the decoded result is passed to the game thread, the delegates are moved so they're not copied on the worker
+				AsyncTask(ENamedThreads::GameThread, [OnSuccess = MoveTemp(OnSuccess), OnInvalidResponse = MoveTemp(OnInvalidResponse), Result = MoveTemp(Result), bSuccess]()
+					{
+						if (bSuccess)
+						{
+							OnSuccess.ExecuteIfBound(Result);
+						}
+						else
+						{
+							OnInvalidResponse.ExecuteIfBound();
+						}
+					});
+			});
+		return true;
+	}
+
+	template<typename T>
+	inline typename TEnableIf<TIsHttpResultAsyncDecodable<T>::Value, bool>::Type HandleHttpResultOkAsync(FHttpResponsePtr Response, const THandler<TArray<T>>& OnSuccess, const FSimpleDelegate& OnInvalidResponse)
+	{
+		FHttpResponseDecoder::Launch([Response, OnSuccess, OnInvalidResponse]() mutable
+			{
+				TArray<T> Result;
+				const bool bSuccess = FAccelByteJsonConverter::JsonArrayStringToUStruct(Response->GetContentAsString(), &Result);
+
+				AsyncTask(ENamedThreads::GameThread, [OnSuccess = MoveTemp(OnSuccess), OnInvalidResponse = MoveTemp(OnInvalidResponse), Result = MoveTemp(Result), bSuccess]()
+					{
+						if (bSuccess)
+						{
+							OnSuccess.ExecuteIfBound(Result);
+						}
+						else
+						{
+							OnInvalidResponse.ExecuteIfBound();
+						}
+					});
+			});
+		return true;
+	}
+
 	template<typename T>
-	FHttpRequestCompleteDelegate CreateHttpResultHandler(const T& OnSuccess, const FErrorHandler& OnError, FHttpRetryScheduler* Scheduler = nullptr)
+	FHttpRequestCompleteDelegate CreateHttpResultHandler(const T& OnSuccess, const FErrorHandler& OnError, FHttpRetryScheduler* Scheduler = nullptr, EAccelByteHttpResponseDecoding Decoding = EAccelByteHttpResponseDecoding::Default)
 	{
 		return FHttpRequestCompleteDelegate::CreateLambda(
-			[OnSuccess, OnError, Scheduler](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bFinished)
+			[OnSuccess, OnError, Scheduler, Decoding](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bFinished)
 			{
 				if (Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()))
 				{
+					if (FHttpResponseDecoder::IsAsyncDecoding(Decoding)
+						&& HandleHttpResultOkAsync(Response, OnSuccess, FSimpleDelegate::CreateLambda([OnError]()
+							{
+								OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidResponse), "Invalid JSON response");
+							})))
+					{
+						return;
+					}
+
 					if (!HandleHttpResultOk(Response, TArray<uint8>(), OnSuccess))
 					{
 						OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidResponse), "Invalid JSON response");
@@ -528,15 +629,18 @@ namespace AccelByte
 
 				if (!bFinished)
 				{
-					OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::NetworkError), "Request not sent.");
+					int32 Code;
+					FString Message;
+					HandleHttpRequestNotSent(Request, Code, Message);
+					OnError.ExecuteIfBound(Code, Message);
 					return;
 				}
 
 				// If response is nullptr then search the actual response in the cache
 				if (!Response.IsValid() && Scheduler != nullptr)
 				{
-					FAccelByteHttpCacheItem* Cache = Scheduler->GetHttpCache().GetSerializedHttpCache(Request);
-					if (Cache != nullptr && EHttpResponseCodes::IsOk(Cache->SerializableRequestAndResponse.ResponseCode))
+					const TSharedPtr<FAccelByteHttpCacheItem> Cache = Scheduler->GetHttpCache().GetSerializedHttpCache(Request);
+					if (Cache.IsValid() && EHttpResponseCodes::IsOk(Cache->SerializableRequestAndResponse.ResponseCode))
 					{
 						auto ResponsePayloadByte = Cache->SerializableRequestAndResponse.ResponsePayload;
 						HandleHttpResultOk(nullptr, ResponsePayloadByte, OnSuccess);
@@ -552,13 +656,22 @@ namespace AccelByte
 	}
 
 	template<typename T>
-	FHttpRequestCompleteDelegate CreateHttpResultHandler(const T& OnSuccess, const FCustomErrorHandler& OnError, FHttpRetryScheduler* Scheduler = nullptr)
+	FHttpRequestCompleteDelegate CreateHttpResultHandler(const T& OnSuccess, const FCustomErrorHandler& OnError, FHttpRetryScheduler* Scheduler = nullptr, EAccelByteHttpResponseDecoding Decoding = EAccelByteHttpResponseDecoding::Default)
 	{
 		return FHttpRequestCompleteDelegate::CreateLambda(
-			[OnSuccess, OnError, Scheduler](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bFinished)
+			[OnSuccess, OnError, Scheduler, Decoding](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bFinished)
 			{
 				if (Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()))
 				{
+					if (FHttpResponseDecoder::IsAsyncDecoding(Decoding)
+						&& HandleHttpResultOkAsync(Response, OnSuccess, FSimpleDelegate::CreateLambda([OnError]()
+							{
+								OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidResponse), "Invalid JSON response", FJsonObject{});
+							})))
+					{
+						return;
+					}
+
 					if (!HandleHttpResultOk(Response, TArray<uint8>(), OnSuccess))
 					{
 						OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidResponse), "Invalid JSON response", FJsonObject{});
@@ -568,15 +681,18 @@ namespace AccelByte
 
 				if (!bFinished)
 				{
-					OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::NetworkError), "Request not sent.", FJsonObject{});
+					int32 Code;
+					FString Message;
+					HandleHttpRequestNotSent(Request, Code, Message);
+					OnError.ExecuteIfBound(Code, Message, FJsonObject{});
 					return;
 				}
 
 				// If response is nullptr then search the actual response in the cache
 				if (!Response.IsValid() && Scheduler != nullptr)
 				{
-					FAccelByteHttpCacheItem* Cache = Scheduler->GetHttpCache().GetSerializedHttpCache(Request);
-					if (Cache != nullptr && EHttpResponseCodes::IsOk(Cache->SerializableRequestAndResponse.ResponseCode))
+					const TSharedPtr<FAccelByteHttpCacheItem> Cache = Scheduler->GetHttpCache().GetSerializedHttpCache(Request);
+					if (Cache.IsValid() && EHttpResponseCodes::IsOk(Cache->SerializableRequestAndResponse.ResponseCode))
 					{
 						auto ResponsePayloadByte = Cache->SerializableRequestAndResponse.ResponsePayload;
 						HandleHttpResultOk(nullptr, ResponsePayloadByte, OnSuccess);
@@ -593,14 +709,23 @@ namespace AccelByte
 	}
 
 	template<typename T>
-	FHttpRequestCompleteDelegate CreateHttpResultHandler(const T& OnSuccess, const FOAuthErrorHandler& OnError, FHttpRetryScheduler* Scheduler = nullptr)
+	FHttpRequestCompleteDelegate CreateHttpResultHandler(const T& OnSuccess, const FOAuthErrorHandler& OnError, FHttpRetryScheduler* Scheduler = nullptr, EAccelByteHttpResponseDecoding Decoding = EAccelByteHttpResponseDecoding::Default)
 	{
 		return FHttpRequestCompleteDelegate::CreateLambda(
-			[OnSuccess, OnError, Scheduler](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bFinished)
+			[OnSuccess, OnError, Scheduler, Decoding](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bFinished)
 			{
 				FErrorOAuthInfo ErrorOauthInfo;
 				if (Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()))
 				{
+					if (FHttpResponseDecoder::IsAsyncDecoding(Decoding)
+						&& HandleHttpResultOkAsync(Response, OnSuccess, FSimpleDelegate::CreateLambda([OnError]()
+							{
+								OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidResponse), TEXT("Invalid JSON response"), FErrorOAuthInfo{});
+							})))
+					{
+						return;
+					}
+
 					if (!HandleHttpResultOk(Response, TArray<uint8>(), OnSuccess))
 					{
 						OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::InvalidResponse), TEXT("Invalid JSON response"), ErrorOauthInfo);
@@ -610,15 +735,18 @@ namespace AccelByte
 
 				if (!bFinished)
 				{
-	                OnError.ExecuteIfBound(static_cast<int32>(ErrorCodes::NetworkError), TEXT("Request not sent."), ErrorOauthInfo);
-	                return;
+					int32 ErrorCode;
+					FString ErrorMessage;
+					HandleHttpRequestNotSent(Request, ErrorCode, ErrorMessage);
+					OnError.ExecuteIfBound(ErrorCode, ErrorMessage, ErrorOauthInfo);
+					return;
 	            }
 
 				// If response is nullptr then search the actual response in the cache
 				if (!Response.IsValid() && Scheduler != nullptr)
 				{
-					FAccelByteHttpCacheItem* Cache = Scheduler->GetHttpCache().GetSerializedHttpCache(Request);
-					if (Cache != nullptr && EHttpResponseCodes::IsOk(Cache->SerializableRequestAndResponse.ResponseCode))
+					const TSharedPtr<FAccelByteHttpCacheItem> Cache = Scheduler->GetHttpCache().GetSerializedHttpCache(Request);
+					if (Cache.IsValid() && EHttpResponseCodes::IsOk(Cache->SerializableRequestAndResponse.ResponseCode))
 					{
 						auto ResponsePayloadByte = Cache->SerializableRequestAndResponse.ResponsePayload;
 						HandleHttpResultOk(nullptr, ResponsePayloadByte, OnSuccess);
@@ -634,14 +762,23 @@ namespace AccelByte
 	}
 
 	template<typename T, typename U>
-	FHttpRequestCompleteDelegate CreateHttpResultHandler(const T& OnSuccess, const U& OnError, FHttpRetryScheduler* Scheduler = nullptr)
+	FHttpRequestCompleteDelegate CreateHttpResultHandler(const T& OnSuccess, const U& OnError, FHttpRetryScheduler* Scheduler = nullptr, EAccelByteHttpResponseDecoding Decoding = EAccelByteHttpResponseDecoding::Default)
 	{
 		return FHttpRequestCompleteDelegate::CreateLambda(
-			[OnSuccess, OnError, Scheduler]
+			[OnSuccess, OnError, Scheduler, Decoding]
 		(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bFinished)
 		{
 			if (Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode()))
 			{
+				if (FHttpResponseDecoder::IsAsyncDecoding(Decoding)
+					&& HandleHttpResultOkAsync(Response, OnSuccess, FSimpleDelegate::CreateLambda([OnError]()
+						{
+							OnError.ExecuteIfBound({ TEXT("InvalidResponse"), TEXT("Invalid JSON response") });
+						})))
+				{
+					return;
+				}
+
 				if (!HandleHttpResultOk(Response, TArray<uint8>(), OnSuccess))
 				{
 					OnError.ExecuteIfBound({ TEXT("InvalidResponse"), TEXT("Invalid JSON response") });
@@ -658,8 +795,8 @@ namespace AccelByte
 			// If response is nullptr then search the actual response in the cache
 			if (!Response.IsValid() && Scheduler != nullptr)
 			{
-				FAccelByteHttpCacheItem* Cache = Scheduler->GetHttpCache().GetSerializedHttpCache(Request);
-				if (Cache != nullptr && EHttpResponseCodes::IsOk(Cache->SerializableRequestAndResponse.ResponseCode))
+				const TSharedPtr<FAccelByteHttpCacheItem> Cache = Scheduler->GetHttpCache().GetSerializedHttpCache(Request);
+				if (Cache.IsValid() && EHttpResponseCodes::IsOk(Cache->SerializableRequestAndResponse.ResponseCode))
 				{ 
 					auto ResponsePayloadByte = Cache->SerializableRequestAndResponse.ResponsePayload;
 					HandleHttpResultOk(nullptr, ResponsePayloadByte, OnSuccess);
@@ -7,7 +7,6 @@
 #include "CoreMinimal.h"
 #include "HttpManager.h"
 #include "Misc/ScopeLock.h"
-#include "Misc/ScopeTryLock.h"
 #include "Core/AccelByteLRUCache.h"
 #include "Models/AccelByteGeneralModels.h"
 
@@ -16,6 +15,53 @@ namespace AccelByte
 
 	namespace Core
 	{
+		/**
+		 * @brief Counters of the HTTP cache, for a single route or for the whole cache.
+		 * The eviction, entry and size values are only tracked for the whole cache.
+		 * With a persistent storage, they are those of the storage shared by every cache of the process.
+		 */
+		struct ACCELBYTEUE4SDK_API FAccelByteHttpCacheStats
+		{
+			// Fresh cached responses served instead of sending the request
+			int64 HitNum = 0;
+
+			// Stale cached responses served, within the stale-while-revalidate or stale-if-error window
+			int64 StaleHitNum = 0;
+
+			// Requests sent because nothing could be served from the cache
+			int64 MissNum = 0;
+
+			// Cached 404 and 410 responses served instead of sending the request
+			int64 NegativeHitNum = 0;
+
+			// Conditional requests answered with 304, the cached response is reused
+			int64 NotModifiedNum = 0;
+
+			// Conditional requests answered with a new response
+			int64 ModifiedNum = 0;
+
+			// Entries evicted because the entry count limit or the size limit is reached
+			int64 CountEvictionNum = 0;
+			int64 SizeEvictionNum = 0;
+
+			int64 ResidentBytes = 0;
+			int32 EntryNum = 0;
+
+			// Cached 404 and 410 responses, they are kept apart from the other entries
+			int32 NegativeEntryNum = 0;
+
+			double GetHitRatio() const
+			{
+				const int64 ServedNum = HitNum + StaleHitNum + NegativeHitNum;
+				const int64 LookupNum = ServedNum + MissNum;
+				return LookupNum > 0 ? static_cast<double>(ServedNum) / LookupNum : 0.0;
+			}
+
+			int64 GetAverageEntrySize() const { return EntryNum > 0 ? ResidentBytes / EntryNum : 0; }
+
+			FAccelByteHttpCacheStats& operator+=(const FAccelByteHttpCacheStats& Other);
+		};
+
 		class ACCELBYTEUE4SDK_API FAccelByteHttpCache
 		{
 		public:
@@ -27,44 +73,257 @@ namespace AccelByte
 			/// Obtain the value from configuration to determine which caching method is chosen.
 			/// We need to avoid access configuration (AccelByte::FRegistry.Settings) from a class constructor
 			/// Because FRegistry.Settings load the value when triggered by startup module phase
+			/// The storage of each shard is created on its first access, the configured limits are split between the shards.
 			/// </summary>
 			void InitializeFromConfig();
 
 			bool TryRetrieving(FHttpRequestPtr& Out, FHttpResponsePtr& OutCachedResponse);
+
+			/**
+			 * @brief Retrieve the cached response of a request, a stale response is served within its stale-while-revalidate window.
+			 *
+			 * @param Out - The request, replaced by the cached request when retrieved
+			 * @param OutCachedResponse - The cached response, might be null if the storage only keeps the serialized response
+			 * @param bOutShouldRevalidate - The served response is stale, it should be revalidated in background
+			 * @return true if a cached response can be served instead of sending the request
+			*/
+			bool TryRetrieving(FHttpRequestPtr& Out, FHttpResponsePtr& OutCachedResponse, bool& bOutShouldRevalidate);
+
+			/**
+			 * @brief Retrieve the cached response for a request that got a 304, or that failed within the stale-if-error window.
+			 *
+			 * @param Request - The finished request
+			 * @param OutCachedResponse - The cached response, might be null if the storage only keeps the serialized response
+			 * @return true if the cached response should be served instead of the request's response
+			*/
+			bool TryRetrievingFallback(const FHttpRequestPtr& Request, FHttpResponsePtr& OutCachedResponse);
+
 			bool TryStoring(const FHttpRequestPtr& Request);
 
+			/**
+			 * @brief Register a conditional request that revalidates the cached response in background.
+			 * The cache is not served to the registered request, so it goes to the server.
+			 *
+			 * @return false if the cached response is already being revalidated
+			*/
+			bool StartRevalidation(const FHttpRequestPtr& RevalidationRequest);
+			void FinishRevalidation(const FHttpRequestPtr& RevalidationRequest);
+
 			/// <summary>
 			/// Should not be called from destructor at all.
 			/// Call this from module shutdown only.
+			/// The persistent storage is shared by every cache of the process, clearing it clears theirs as well.
 			/// </summary>
-			void ClearCache();
+			/// <param name="bClearPersistentStorage">False to keep the persisted entries for the next session.</param>
+			void ClearCache(bool bClearPersistentStorage = true);
 
 			/**
 			 * @brief To be called by CreateHttpResultHandler to obtain the CacheItem
 			 *
 			 * @param The CompletedRequest
-			 * @return Return pointer to the cache , else return nullpointer if invalid
+			 * @return Return the cached item, it stays valid after the entry is evicted, else return nullptr if invalid
 			*/
-			FAccelByteHttpCacheItem* GetSerializedHttpCache(const FHttpRequestPtr& Request);
+			TSharedPtr<FAccelByteHttpCacheItem> GetSerializedHttpCache(const FHttpRequestPtr& Request);
+
+			/**
+			 * @brief Get the counters of the whole cache, with the current entry count and size of the storages
+			 */
+			FAccelByteHttpCacheStats GetStats();
+
+			/**
+			 * @brief Get the request counters of each route, the identifier segments of the URL path are replaced by a placeholder
+			 */
+			TMap<FString, FAccelByteHttpCacheStats> GetRouteStats();
+
+			void ResetStats();
+
+			/**
+			 * @brief Cache the 404 and 410 responses of GET requests for a short time, overriding the configuration.
+			 * The negative entries are only kept in memory, apart from the other entries so they never evict them.
+			 *
+			 * @param bEnabled - Disabling drops the current negative entries
+			 * @param TtlSeconds - Time a negative entry is served, shortened by the response's max-age
+			 * @param MaxEntryNum - Maximum number of negative entries, the closest to expire are dropped first
+			 */
+			void SetNegativeCachePolicy(bool bEnabled, int32 TtlSeconds, int32 MaxEntryNum);
 
 		protected:
 
 			static int MaxAgeCacheThreshold;
 			
-			static FName ConstructKey(const FHttpRequestPtr& Request);
+			/**
+			 * @brief Hash the identity of a request into its cache key.
+			 * The identity is the verb, the canonical URL, the user of the Authorization header and the request
+			 * headers the cached response varies on.
+			 */
+			FAccelByteCacheKey ConstructKey(const FHttpRequestPtr& Request);
+
+			/**
+			 * @brief Hash the identity of a request as if it was sent with another verb
+			 */
+			FAccelByteCacheKey ConstructKey(const FHttpRequestPtr& Request, const FString& Verb);
+
+			/**
+			 * @brief Hash the identity of a request without the headers the response varies on
+			 *
+			 * @param OutIdentity - The hashed identity, the varying headers are appended to it
+			 */
+			FAccelByteCacheKey ConstructPrimaryKey(const FHttpRequestPtr& Request, const FString& Verb, FString& OutIdentity);
+
+			/**
+			 * @brief Get the URL with its scheme and host lowercased, its fragment dropped and its query parameters sorted by name
+			 */
+			static FString CanonicalizeUrl(const FString& Url);
+
+			/**
+			 * @brief Get the user of an Authorization header, the subject claim of a bearer JWT so it survives the token refreshes.
+			 * Any other credential is returned as is.
+			 */
+			static FString GetAuthorizationSubject(const FString& Authorization);
+
+			/**
+			 * @brief GetAuthorizationSubject remembered per Authorization header, the token is only decoded once
+			 */
+			FString FindAuthorizationSubject(const FString& Authorization);
+
+			/**
+			 * @brief Remember the request headers named by the Vary header of a response, they are part of the following keys
+			 *
+			 * @return false if the response varies on everything ("*") and can't be cached
+			 */
+			bool UpdateVaryHeaders(const FHttpRequestPtr& Request, const FHttpResponsePtr& Response);
+
+			// Maximum number of resources with a remembered Vary header, the oldest are forgotten all at once
+			static constexpr int32 MaxVaryEntryNum = 1024;
+
+			// Lowercased request header names each resource varies on, keyed by the key without the varying headers
+			FCriticalSection VaryCritSection;
+			TMap<FAccelByteCacheKey, TArray<FString>> VaryHeaders;
+
+			// Maximum number of remembered Authorization headers, the refreshed tokens are forgotten all at once
+			static constexpr int32 MaxAuthorizationSubjectNum = 16;
+
+			FCriticalSection AuthorizationSubjectCritSection;
+			TMap<FString, FString> AuthorizationSubjects;
 
 			enum class EHttpCacheFreshness : uint8
 			{
 				STALE = 0,
 				FRESH,
-				WAITING_REFRESH //if the cached item has an ETag value and it still has a chance to get 304 response from the cloud storage provider
+				WAITING_REFRESH, //if the cached item has an ETag value and it still has a chance to get 304 response from the cloud storage provider
+				STALE_WHILE_REVALIDATE //if the cached item is stale but can be served while it is revalidated in background
 			};
 
-			FCriticalSection CacheCritSection;
-			
-			TSharedPtr<FAccelByteLRUCache<FAccelByteHttpCacheItem>> CachedItemsInternal;
-			
-			TSharedPtr<FAccelByteLRUCache<FAccelByteHttpCacheItem>> GetCachedItems();
+			// Number of independent partitions, a key always goes to the same shard
+			static constexpr int32 ShardNum = 8;
+
+			/**
+			 * Each shard gets an equal part of the configured size and entry limits, but never less than these minimums,
+			 * so a large response still fits in a shard and an uneven spread of the keys doesn't evict the hot entries early.
+			 * A configured limit under ShardNum times the minimum is therefore exceeded, up to ShardNum times the minimum.
+			 */
+			static constexpr int32 MinShardSizeBytes = 2 * 1024 * 1024;
+			static constexpr int32 MinShardEntryNum = 16;
+
+			/**
+			 * @brief Lock and persistent storage of a shard index, shared by every cache of the process.
+			 * Two persistent storages opened on the same files would overwrite each other's records,
+			 * so the storage is created once and released with the last cache holding it.
+			 */
+			struct FSharedShard
+			{
+				FCriticalSection CritSection;
+				TWeakPtr<FAccelByteLRUCache<FAccelByteHttpCacheItem>> PersistentItems;
+			};
+
+			static FSharedShard& GetSharedShard(int32 ShardIndex);
+
+			/**
+			 * @brief Partition of the cache with its own storage, limits and lock.
+			 * Every lookup promotes the entry or goes through the storage's read buffer, so the lock is exclusive.
+			 * The lock is the one of the shared shard, a persistent storage is shared along with it.
+			 */
+			struct FShard
+			{
+				int32 Index = 0;
+				FCriticalSection* CritSection = nullptr;
+				TSharedPtr<FAccelByteLRUCache<FAccelByteHttpCacheItem>> CachedItemsInternal;
+				FAccelByteHttpCacheStats Stats;
+
+				// Evictions of the current storage that are not part of Stats, already counted or reset
+				int64 CountEvictionBase = 0;
+				int64 SizeEvictionBase = 0;
+			};
+
+			FShard Shards[ShardNum];
+
+			FCriticalSection RouteStatsCritSection;
+			TMap<FString, FAccelByteHttpCacheStats> RouteStats;
+
+			/**
+			 * @brief Increment a request counter of the shard and of the request's route, the shard's lock must be held.
+			 */
+			void RecordRequest(FShard& Shard, const FHttpRequestPtr& Request, int64 FAccelByteHttpCacheStats::* Counter);
+
+			// Background revalidation in flight for each cached key
+			FCriticalSection RevalidationCritSection;
+			TMap<FAccelByteCacheKey, FHttpRequestPtr> RevalidationRequests;
+
+			/**
+			 * @brief Cached 404 or 410 response, the request is held with its response so the error handlers can read it
+			 */
+			struct FNegativeCacheEntry
+			{
+				FHttpRequestPtr Request;
+				double ExpireTime = 0.0;
+			};
+
+			// Negative entries, locked after the shard's lock when both are held
+			FCriticalSection NegativeCritSection;
+			bool bIsNegativeCacheConfigLoaded = false;
+			bool bIsNegativeCacheEnabled = false;
+			int32 NegativeCacheTtlSeconds = 10;
+			int32 NegativeCacheMaxEntryNum = 256;
+			TMap<FAccelByteCacheKey, FNegativeCacheEntry> NegativeEntries;
+
+			/**
+			 * @brief Read the negative cache settings on the first access, the negative cache's lock must be held
+			 */
+			void LoadNegativeCacheConfig();
+
+			/**
+			 * @brief Find the unexpired negative entry of a key, an expired one is removed
+			 *
+			 * @return The cached request holding the 404 or 410 response, nullptr if none
+			 */
+			FHttpRequestPtr FindNegativeEntry(const FAccelByteCacheKey& Key);
+
+			/**
+			 * @brief Cache a 404 or 410 response to a GET request, unless negative caching is disabled or the response is no-store
+			 *
+			 * @return true if the response is cached
+			 */
+			bool TryStoringNegative(const FAccelByteCacheKey& Key, const FHttpRequestPtr& Request, const FAccelByteHttpCachePolicy& Policy);
+
+			static bool IsNegativeResponse(const FHttpRequestPtr& CompletedRequest);
+
+			/**
+			 * @brief Remove the cached response and the negative entry of a GET to the URL of a successful write, for the same user.
+			 * The headers the response varies on are taken from the write request.
+			 */
+			void RemoveReadEntries(const FHttpRequestPtr& WriteRequest);
+
+			FShard& GetShard(const FAccelByteCacheKey& Key);
+
+			/**
+			 * @brief Get the storage of a shard, created from the configuration on the first access.
+			 * The shard's lock must be held.
+			 */
+			TSharedPtr<FAccelByteLRUCache<FAccelByteHttpCacheItem>> GetCachedItems(FShard& Shard);
+			static TSharedPtr<FAccelByteLRUCache<FAccelByteHttpCacheItem>> CreateCachedItems(int32 ShardIndex);
+			static int32 GetShardLimit(int32 ConfiguredLimit, int32 MinShardLimit);
+
+			bool IsRevalidationRequest(const FAccelByteCacheKey& Key, const FHttpRequestPtr& Request);
 
 		public:
 
@@ -76,23 +335,33 @@ namespace AccelByte
 			*/
 			static bool IsResponseCacheable(const FHttpRequestPtr& CompletedRequest);
 
-		private:
 			/**
-			 * @brief Check whether the cached response is not stale nor invalid
+			 * @brief Check the caching prerequisites with the directives already parsed from the response
 			 *
-			 * @param Key - Key for a HttpCache content
-			 * @return EHttpCacheFreshness 
+			 * @param CompletedRequest - Request with completed response
+			 * @param Policy - Directives parsed from the response
+			 * @return true if cacheable (cache-directive, response code and request verb OK), false otherwise
 			*/
-			FAccelByteHttpCache::EHttpCacheFreshness CheckCachedItemFreshness(const FName& Key);
+			static bool IsResponseCacheable(const FHttpRequestPtr& CompletedRequest, const FAccelByteHttpCachePolicy& Policy);
 
 			/**
-			 * @brief Extract specific control directive value from a Cache-Control header
-			 * 
-			 * @param CacheControlHeader
-			 * @param ControlDirective
-			 * @return FString - Value of the control directive. Empty if not found
+			 * @brief Parse the Cache-Control, Age, Expires and ETag headers of a response in a single pass
+			 *
+			 * @param Response - Response to parse
+			 * @return The parsed directives, defaults if the response is invalid
+			*/
+			static FAccelByteHttpCachePolicy ParseCachePolicy(const FHttpResponsePtr& Response);
+
+		private:
+			/**
+			 * @brief Check whether the cached response is not stale nor invalid, only the stored policy is compared
+			 *
+			 * @param CachedItems - Storage of the shard owning the key, its lock must be held
+			 * @param Key - Key for a HttpCache content
+			 * @param CachedItem - The item stored for the key
+			 * @return EHttpCacheFreshness 
 			*/
-			static FString ExtractControlDirective(const FString& CacheControlHeader, const FString& ControlDirective);
+			FAccelByteHttpCache::EHttpCacheFreshness CheckCachedItemFreshness(FAccelByteLRUCache<FAccelByteHttpCacheItem>& CachedItems, const FAccelByteCacheKey& Key, const FAccelByteHttpCacheItem& CachedItem);
 		};
 
 	} // namespace Core
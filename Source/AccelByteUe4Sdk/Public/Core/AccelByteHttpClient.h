@@ -50,6 +50,85 @@ namespace AccelByte
 			, FHttpRetryScheduler & InHttpRef);
 		~FHttpClient();
 
+		/**
+		 * @brief Set the priority class of the requests sent by this client, unless specified on the request.
+		 *
+		 * @param InPriority Priority class of the requests, defaults to Interactive.
+		 */
+		void SetDefaultRequestPriority(EAccelByteHttpRequestPriority InPriority) { RequestPriority = InPriority; }
+
+		EAccelByteHttpRequestPriority GetDefaultRequestPriority() const { return RequestPriority; }
+
+		/**
+		 * @brief Set the deadline and retry policy of the requests sent by this client, unless specified on the request.
+		 *
+		 * @param InPolicy Request policy, the zero values fall back to the scheduler settings.
+		 *                 ResponseDecoding picks the thread decoding the successful responses.
+		 */
+		void SetDefaultRequestPolicy(FHttpRequestPolicy const& InPolicy) { RequestPolicy = InPolicy; }
+
+		FHttpRequestPolicy const& GetDefaultRequestPolicy() const { return RequestPolicy; }
+
+		/**
+		 * @brief Basic HTTP request with a specific priority class, takes the same arguments as the other Request overloads.
+		 * Braced initializer lists can't be forwarded, pass the explicit type instead, e.g. FHttpFormData{}.
+		 *
+		 * @param Priority Priority class of the request.
+		 *
+		 * @return FAccelByteTaskPtr.
+		 */
+		template<typename... TArgs>
+		FAccelByteTaskPtr Request(EAccelByteHttpRequestPriority Priority, TArgs&&... Args)
+		{
+			TGuardValue<EAccelByteHttpRequestPriority> PriorityGuard(RequestPriority, Priority);
+			return Request(Forward<TArgs>(Args)...);
+		}
+
+		/**
+		 * @brief API request with a specific priority class, takes the same arguments as the other ApiRequest overloads.
+		 * Braced initializer lists can't be forwarded, pass the explicit type instead, e.g. FHttpFormData{}.
+		 *
+		 * @param Priority Priority class of the request.
+		 *
+		 * @return FAccelByteTaskPtr.
+		 */
+		template<typename... TArgs>
+		FAccelByteTaskPtr ApiRequest(EAccelByteHttpRequestPriority Priority, TArgs&&... Args)
+		{
+			TGuardValue<EAccelByteHttpRequestPriority> PriorityGuard(RequestPriority, Priority);
+			return ApiRequest(Forward<TArgs>(Args)...);
+		}
+
+		/**
+		 * @brief Basic HTTP request with a specific deadline and retry policy, takes the same arguments as the other Request overloads.
+		 * Braced initializer lists can't be forwarded, pass the explicit type instead, e.g. FHttpFormData{}.
+		 *
+		 * @param Policy Deadline and retry policy of the request.
+		 *
+		 * @return FAccelByteTaskPtr.
+		 */
+		template<typename... TArgs>
+		FAccelByteTaskPtr Request(FHttpRequestPolicy const& Policy, TArgs&&... Args)
+		{
+			TGuardValue<FHttpRequestPolicy> PolicyGuard(RequestPolicy, Policy);
+			return Request(Forward<TArgs>(Args)...);
+		}
+
+		/**
+		 * @brief API request with a specific deadline and retry policy, takes the same arguments as the other ApiRequest overloads.
+		 * Braced initializer lists can't be forwarded, pass the explicit type instead, e.g. FHttpFormData{}.
+		 *
+		 * @param Policy Deadline and retry policy of the request.
+		 *
+		 * @return FAccelByteTaskPtr.
+		 */
+		template<typename... TArgs>
+		FAccelByteTaskPtr ApiRequest(FHttpRequestPolicy const& Policy, TArgs&&... Args)
+		{
+			TGuardValue<FHttpRequestPolicy> PolicyGuard(RequestPolicy, Policy);
+			return ApiRequest(Forward<TArgs>(Args)...);
+		}
+
 		/**
 		 * @brief Basic HTTP request
 		 *
@@ -654,6 +733,8 @@ namespace AccelByte
 		FHttpRetryScheduler& HttpRef;
 		BaseCredentials const& CredentialsRef;
 		BaseSettings const& SettingsRef;
+		EAccelByteHttpRequestPriority RequestPriority{ EAccelByteHttpRequestPriority::Interactive };
+		FHttpRequestPolicy RequestPolicy{};
 
 		FString FormatApiUrl(FString const& Url) const;
 
@@ -735,9 +816,12 @@ namespace AccelByte
 				, CreateHttpResultHandler(
 					OnSuccess,
 					OnError,
-					&HttpRef
+					&HttpRef,
+					RequestPolicy.ResponseDecoding
 				)
-				, FPlatformTime::Seconds());
+				, FPlatformTime::Seconds()
+				, RequestPriority
+				, RequestPolicy);
 		}
 	};
 
@@ -0,0 +1,72 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Misc/ScopeLock.h"
+#include "Templates/Function.h"
+
+namespace AccelByte
+{
+/**
+ * @brief Where the body of a successful HTTP response is decoded before the success delegate is executed.
+ */
+enum class EAccelByteHttpResponseDecoding : uint8
+{
+	/** Follow the global setting, see FHttpResponseDecoder::SetAsyncDecodingEnabled. */
+	Default = 0,
+
+	/** Decode on the game thread right before executing the delegate. */
+	GameThread,
+
+	/** Decode on a worker thread, only the decoded result is passed back to the game thread. */
+	Async
+};
+
+/**
+ * @brief Runs the JSON decoding of HTTP responses on worker threads, with a bounded number of jobs in flight.
+ * The jobs over the limit are queued and started in order as the running jobs finish.
+ */
+class ACCELBYTEUE4SDK_API FHttpResponseDecoder
+{
+public:
+	static void SetAsyncDecodingEnabled(bool bEnabled) { bAsyncDecodingEnabled = bEnabled; }
+	static bool IsAsyncDecodingEnabled() { return bAsyncDecodingEnabled; }
+
+	/**
+	 * @brief Whether a response should be decoded on a worker thread, resolving Default to the global setting.
+	 */
+	static bool IsAsyncDecoding(EAccelByteHttpResponseDecoding Decoding);
+
+	/**
+	 * @brief Set the maximum number of decode jobs running at the same time, minimum 1.
+	 */
+	static void SetMaxDecodeJobs(int32 MaxJobs);
+	static int32 GetMaxDecodeJobs() { return MaxDecodeJobs; }
+
+	static int32 GetDecodeJobNum();
+	static int32 GetQueuedDecodeJobNum();
+
+	/**
+	 * @brief Run the decode job on a worker thread, or queue it when the maximum jobs are running.
+	 * The job is responsible to pass its result back to the game thread.
+	 */
+	static void Launch(TUniqueFunction<void()>&& DecodeJob);
+
+private:
+	static void StartJob(TUniqueFunction<void()>&& DecodeJob);
+	static void FinishJob();
+
+	static bool bAsyncDecodingEnabled;
+	static int32 MaxDecodeJobs;
+
+	static FCriticalSection JobsLock;
+	static int32 DecodeJobNum;
+	static int32 QueuedDecodeJobNum;
+	static TQueue<TUniqueFunction<void()>> QueuedJobs;
+};
+
+}
@@ -10,17 +10,86 @@
 #include "HttpManager.h"
 #include "Core/AccelByteTask.h"
 #include "Core/AccelByteHttpCache.h"
+#include "Core/AccelByteHttpResponseDecoder.h"
 #include "Core/AccelByteDefines.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteHttpRetry, Log, All);
 
 namespace AccelByte
 {
+/**
+ * @brief Priority class of an HTTP request. Higher class is dispatched first and each class has its own in-flight limit.
+ */
+enum class EAccelByteHttpRequestPriority : uint8
+{
+	/** Authentication and session requests, e.g. login, token refresh, matchmaking and session. */
+	Critical = 0,
+
+	/** Requests that the player is waiting for. */
+	Interactive,
+
+	/** Requests that the player is not waiting for, e.g. telemetry, metrics and prefetch. */
+	Background,
+
+	Num
+};
+
+/**
+ * @brief State of the circuit breaker of a route.
+ */
+enum class EAccelByteCircuitBreakerState : uint8
+{
+	/** Requests are sent normally, the failure rate is observed. */
+	Closed = 0,
+
+	/** The failure rate reached the threshold, requests fail fast without being sent. */
+	Open,
+
+	/** The open duration elapsed, a single probe request is sent to check whether the route has recovered. */
+	HalfOpen
+};
+
+/**
+ * @brief Deadline, retry and completion policy of an HTTP request, a zero value falls back to the scheduler setting.
+ */
+struct FHttpRequestPolicy
+{
+	/** Seconds from the request time until the request is given up, including the retries. */
+	double Deadline{};
+
+	/** Maximum number of times the request is sent, including the first attempt, 0 means until the deadline. */
+	int32 MaxAttempts{};
+
+	/** Backoff delay before the first retry. */
+	double InitialDelay{};
+
+	/** Upper bound of the backoff delay. */
+	double MaximumDelay{};
+
+	/** Growth factor of the backoff delay on each retry. */
+	double BackoffMultiplier{};
+
+	/**
+	 * Whether the request can be sent again when it may have reached the server, e.g. on 5xx, timeout or connection error.
+	 * Non-idempotent requests are only retried when the server rejected them without processing (429, 449 and 503).
+	 */
+	bool bIsIdempotent{ true };
+
+	/** Where the body of a successful response is decoded, e.g. Async for large pages of items or entitlements. */
+	EAccelByteHttpResponseDecoding ResponseDecoding{ EAccelByteHttpResponseDecoding::Default };
+};
+
+/**
+ * @brief Marker header set on a request that the scheduler finished without sending, the value is the ErrorCodes reason.
+ */
+const constexpr TCHAR* GHeaderABRequestNotSentReason = TEXT("X-AB-RequestNotSentReason");
+
 class ACCELBYTEUE4SDK_API FHttpRetryScheduler
 {
 public:
 	DECLARE_DELEGATE(FBearerAuthRejected);
 	DECLARE_MULTICAST_DELEGATE_OneParam(FBearerAuthRejectedRefresh, FString const&);
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FOnCircuitBreakerStateChanged, const FString& /* Route */, EAccelByteCircuitBreakerState /* State */);
 
 	/**
 	 * @brief A delegate to handle specified HTTP status code when the HTTP request succeeded
@@ -34,6 +103,34 @@ public:
 	 * @return EAccelByteTaskState The next state
 	 */
 	DECLARE_DELEGATE_RetVal_OneParam(EAccelByteTaskState, FHttpResponseCodeHandler, int32 /* StatusCode */);
+
+	/**
+	 * @brief Immutable table of the custom HTTP status code handlers, shared by the tasks instead of being copied.
+	 * Setting or removing a handler publishes a new table, tasks keep the table they are created with.
+	 */
+	typedef TMap<int32 /* StatusCode */, FHttpResponseCodeHandler> FHttpResponseCodeHandlerMap;
+	typedef TSharedRef<const FHttpResponseCodeHandlerMap, ESPMode::ThreadSafe> FHttpResponseCodeHandlersRef;
+
+	DECLARE_DELEGATE_ThreeParams(FOnRequestAttemptCompleted, const FString& /* Route */, double /* Time */, bool /* bIsFailed */);
+	DECLARE_DELEGATE_RetVal_TwoParams(bool, FOnRequestRetryRequested, const FString& /* Route */, double /* Time */);
+	DECLARE_DELEGATE_TwoParams(FOnRouteThrottled, const FString& /* Route */, double /* ThrottledUntilTime */);
+
+	/**
+	 * @brief Callbacks of the scheduler about the attempts of a request, given the route stored on its task.
+	 * Bound once per scheduler and shared by its tasks instead of being bound with the route of each request.
+	 */
+	struct FRequestAttemptDelegates
+	{
+		/** Reports whether an attempt failed (5xx, connection error or timeout). */
+		FOnRequestAttemptCompleted OnAttemptCompleted;
+
+		/** Asks whether a failed attempt can be retried. */
+		FOnRequestRetryRequested OnRetryRequested;
+
+		/** Reports that the server asked to back off the route until the given time. */
+		FOnRouteThrottled OnThrottled;
+	};
+	typedef TSharedPtr<const FRequestAttemptDelegates, ESPMode::ThreadSafe> FRequestAttemptDelegatesPtr;
 	
 	static int InitialDelay;
 	static int MaximumDelay;
@@ -43,7 +140,16 @@ public:
 	FHttpRetryScheduler();
 	virtual ~FHttpRetryScheduler();
 
-	FAccelByteTaskPtr ProcessRequest(FHttpRequestPtr Request, const FHttpRequestCompleteDelegate& CompleteDelegate, double RequestTime);
+	FAccelByteTaskPtr ProcessRequest(FHttpRequestPtr Request
+		, const FHttpRequestCompleteDelegate& CompleteDelegate
+		, double RequestTime
+		, EAccelByteHttpRequestPriority Priority = EAccelByteHttpRequestPriority::Interactive
+		, const FHttpRequestPolicy& Policy = FHttpRequestPolicy{});
+
+	/**
+	 * @brief Get the policy with its zero values replaced by the scheduler settings.
+	 */
+	static FHttpRequestPolicy ResolveRequestPolicy(const FHttpRequestPolicy& Policy);
 
 	void SetBearerAuthRejectedDelegate(FBearerAuthRejected BearerAuthRejected);
 	void BearerAuthRejected();
@@ -56,6 +162,66 @@ public:
 
 	static void SetHttpResponseCodeHandlerDelegate(EHttpResponseCodes::Type StatusCode, const FHttpResponseCodeHandler& Handler);
 	static bool RemoveHttpResponseCodeHandlerDelegate(EHttpResponseCodes::Type StatusCode);
+	static FHttpResponseCodeHandlersRef GetHttpResponseCodeHandlers() { return ResponseCodeHandlers; }
+	static uint32 GetHttpResponseCodeHandlersVersion() { return ResponseCodeHandlersVersion; }
+
+	/**
+	 * @brief Enable sending only one of the identical in-flight GET requests (same URL, Authorization, Accept and Namespace),
+	 * the other requests are completed with the same response.
+	 * Each caller gets its own task, cancelling it only detaches that caller from the shared request.
+	 */
+	static void SetRequestCoalescingEnabled(bool bEnabled) { bRequestCoalescingEnabled = bEnabled; }
+	static bool IsRequestCoalescingEnabled() { return bRequestCoalescingEnabled; }
+
+	/**
+	 * @brief Number of requests that are completed by an identical in-flight request instead of being sent.
+	 */
+	int64 GetCoalescedRequestNum() const { return CoalescedRequestNum; }
+
+	/**
+	 * @brief Number of in-flight requests that can be joined by an identical request.
+	 */
+	int32 GetCoalescableRequestNum() const { return InFlightRequests.Num(); }
+
+	/**
+	 * @brief Set the maximum number of dispatched and unfinished requests of a priority class, 0 means unlimited.
+	 * The requests over the limit are queued and dispatched in priority order.
+	 */
+	static void SetMaxDispatchedRequests(EAccelByteHttpRequestPriority Priority, int32 MaxRequests);
+	static int32 GetMaxDispatchedRequests(EAccelByteHttpRequestPriority Priority);
+
+	int32 GetDispatchedRequestNum(EAccelByteHttpRequestPriority Priority) const;
+	int32 GetQueuedRequestNum(EAccelByteHttpRequestPriority Priority) const;
+
+	/**
+	 * @brief Enable the per route circuit breakers, an open breaker fails the requests of its route fast with ErrorCodes::CircuitBreakerOpen.
+	 * Disabled by default, also enabled with [HTTP] EnableCircuitBreaker=true.
+	 */
+	static void SetCircuitBreakerEnabled(bool bEnabled) { bCircuitBreakerEnabled = bEnabled; }
+	static bool IsCircuitBreakerEnabled() { return bCircuitBreakerEnabled; }
+
+	EAccelByteCircuitBreakerState GetCircuitBreakerState(const FString& Url) const;
+
+	/**
+	 * @brief Broadcast when the circuit breaker of a route is opened, half-opened or closed, e.g. to disable the features depending on it.
+	 */
+	FOnCircuitBreakerStateChanged& OnCircuitBreakerStateChanged() { return CircuitBreakerStateChanged; }
+
+	/**
+	 * @brief Number of retries that are not sent because the retry budget is exhausted or the circuit breaker is not closed.
+	 * The retry budget is disabled by default, it is enabled with a ratio above zero, e.g. [HTTP] RetryBudgetRatio=0.2.
+	 */
+	int64 GetRejectedRetryNum() const { return RejectedRetryNum; }
+
+	/**
+	 * @brief Get the delay the server asks for before the next request, from the Retry-After header of a 429 or 503 response
+	 * (seconds or HTTP-date), otherwise from the RateLimit-Reset / X-RateLimit-Reset header when no request remains.
+	 *
+	 * @param Response The HTTP response
+	 * @param OutDelay Seconds to wait from now
+	 * @return true if the server asked to back off
+	 */
+	static bool GetServerRetryDelay(const FHttpResponsePtr& Response, double& OutDelay);
 
 	static void SetHeaderNamespace(const FString& Value) { HeaderNamespace = Value; }
 	static void SetHeaderSDKVersion(const FString& Value) { HeaderSDKVersion = Value; }
@@ -64,15 +230,88 @@ public:
 
 	Core::FAccelByteHttpCache& GetHttpCache() { return HttpCache; }
 
+	/**
+	 * @brief Get the rate limit route of a URL, the host and path with the identifier segments replaced by a placeholder.
+	 * e.g. https://host/iam/v3/public/namespaces/game/users/0123456789abcdef0123456789abcdef -> https://host/iam/v3/public/namespaces/game/users/{id}
+	 */
+	static FString GetRequestRoute(const FString& Url);
+
 protected:
-	static TMap<EHttpResponseCodes::Type, FHttpResponseCodeHandler> ResponseCodeDelegates;
-	TMap<FString /*Endpoint*/, FRequestBucket> RequestsBucket;
+	/**
+	 * @brief Entry of the timer heap, ordered by the time the task needs to be ticked.
+	 * Entry is stale when its generation doesn't match the task's current schedule generation.
+	 */
+	struct FScheduledTask
+	{
+		double Time{};
+		uint32 Generation{};
+		FAccelByteTaskPtr Task{};
+
+		bool operator<(const FScheduledTask& Other) const { return Time < Other.Time; }
+	};
+
+	typedef TQueue<FAccelByteTaskWeakPtr, EQueueMode::Mpsc> FTaskWakeUpQueue;
+
+	static FHttpResponseCodeHandlersRef ResponseCodeHandlers;
+	static uint32 ResponseCodeHandlersVersion;
+	TMap<FString /*Route*/, FRequestBucket> RequestsBucket;
+	/** Requests waiting for their route bucket to get a token, in arrival order. */
+	TMap<FString /*Route*/, TArray<FAccelByteTaskPtr>> PendingRequests;
+	/** Configured rate limit for the routes containing the key, the longest match wins. */
+	TArray<TPair<FString /*Route*/, int32 /*RateLimit*/>> RouteRateLimits;
+	double LastRequestsBucketEvictionTime{};
+	/** In-flight GET requests that can be joined by an identical request. */
+	TMap<FString /*CoalescingKey*/, FAccelByteTaskWeakPtr> InFlightRequests;
+	int64 CoalescedRequestNum{};
+
+	/**
+	 * @brief Failure rate of a route observed over a window, and the breaker state driven by it.
+	 */
+	struct FCircuitBreaker
+	{
+		EAccelByteCircuitBreakerState State{ EAccelByteCircuitBreakerState::Closed };
+		int32 RequestNum{};
+		int32 FailureNum{};
+		double WindowStartTime{};
+		double OpenTime{};
+		/** Time the half-open probe request is let through, 0 when there is none. */
+		double ProbeTime{};
+	};
+
+	TMap<FString /*Route*/, FCircuitBreaker> CircuitBreakers;
+	FOnCircuitBreakerStateChanged CircuitBreakerStateChanged{};
+
+	/** First attempts and retries of the current retry budget window, retries are limited to a ratio of the requests. */
+	int32 RetryBudgetRequestNum{};
+	int32 RetryBudgetRetryNum{};
+	double RetryBudgetWindowStartTime{};
+	int64 RejectedRetryNum{};
 
+	static constexpr int32 PriorityNum = static_cast<int32>(EAccelByteHttpRequestPriority::Num);
+	static int32 MaxDispatchedRequests[PriorityNum];
+	int32 DispatchedRequestNum[PriorityNum]{};
+	/** Requests waiting for a dispatch slot of their priority class, in arrival order. */
+	TArray<FAccelByteTaskPtr> DispatchQueues[PriorityNum];
+
+	/** Newly processed tasks, moved into the timer heap by the polling thread. */
 	TQueue<FAccelByteTaskPtr, EQueueMode::Mpsc> TaskQueue{};
+	/** Min-heap of the live tasks keyed by their next tick time. */
+	TArray<FScheduledTask> TaskHeap{};
+	/** Tasks that need to be ticked immediately, e.g. the HTTP request is completed. */
+	TSharedRef<FTaskWakeUpQueue, ESPMode::ThreadSafe> TaskWakeUpQueue;
 	FDelegateHandleAlias PollRetryHandle{};
 
 	Core::FAccelByteHttpCache HttpCache{};
 
+	FRequestAttemptDelegatesPtr RequestAttemptDelegates{};
+
+	/**
+	 * @brief Send a conditional copy of a cached request at background priority, the stale cached response
+	 * was already served and is refreshed by the response.
+	 */
+	void RevalidateCachedResponse(const FHttpRequestPtr& CachedRequest, double RequestTime);
+	void OnRevalidationCompleted(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSucceeded);
+
 	FBearerAuthRejected BearerAuthRejectedDelegate{};
 	FBearerAuthRejectedRefresh BearerAuthRejectedRefresh{};
 
@@ -87,12 +326,47 @@ protected:
 
 	EState State{EState::Uninitialized};
 
+	void ScheduleTask(const FAccelByteTaskPtr& Task, double Time);
+	void MoveQueuedTasksToHeap();
+	void RebuildTaskHeap();
+	bool IsTaskEntryStale(const FScheduledTask& Entry) const;
+
+	static FString GetCoalescingKey(const FHttpRequestPtr& Request);
+	int32 GetRouteRateLimit(const FString& Route) const;
+	bool TryConsumeRequestToken(const FString& Route, double Time);
+	void AdmitPendingRequests(double Time);
+	void RequeueResumedTasks();
+	void RequeuePendingTask(const FAccelByteTaskPtr& Task);
+	void EvictIdleRequestsBuckets(double Time);
+	bool TryDispatchTask(const FAccelByteTaskPtr& Task);
+	void DispatchOrQueueTask(const FAccelByteTaskPtr& Task, double Time);
+	void DispatchQueuedRequests(double Time);
+
+	bool TryPassCircuitBreaker(const FString& Route, double Time);
+	bool TryRejectByCircuitBreaker(const FAccelByteTaskPtr& Task, double Time);
+	void SetCircuitBreakerState(const FString& Route, FCircuitBreaker& CircuitBreaker, EAccelByteCircuitBreakerState NewState, double Time);
+	void RecordRequestAttempt(const FString& Route, double Time, bool bIsFailed);
+	bool TryRetryRequest(const FString& Route, double Time);
+	void ThrottleRoute(const FString& Route, double ThrottledUntilTime);
+	void UpdateRetryBudgetWindow(double Time);
+
 	//Custom Metadata Header
 	static FString HeaderNamespace;
 	static FString HeaderSDKVersion;
 	static FString HeaderOSSVersion;
 	static FString HeaderGameClientVersion;
 	static int32 RateLimit;
+	static int32 RateLimitMaxPendingRequests;
+	static double RateLimitBucketIdleTimeout;
+	static bool bRequestCoalescingEnabled;
+	static double RetryBudgetRatio;
+	static int32 RetryBudgetMinRetries;
+	static double RetryBudgetWindow;
+	static bool bCircuitBreakerEnabled;
+	static double CircuitBreakerFailureRate;
+	static int32 CircuitBreakerMinRequests;
+	static double CircuitBreakerWindow;
+	static double CircuitBreakerOpenDuration;
 };
 
 typedef TSharedRef<FHttpRetryScheduler, ESPMode::ThreadSafe> FHttpRetrySchedulerRef;	
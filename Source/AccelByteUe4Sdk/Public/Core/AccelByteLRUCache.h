@@ -8,16 +8,82 @@
 #include "Containers/List.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
+#include "Misc/SecureHash.h"
+#include "Models/AccelByteGeneralModels.h"
 
 namespace AccelByte
 {
 namespace Core
 {
 
+/**
+ * @brief 128-bit identifier of a cached item, hashed from what identifies the item.
+ * Unlike an FName, building a key doesn't add anything to a global table.
+ */
+struct FAccelByteCacheKey
+{
+	uint64 High = 0;
+	uint64 Low = 0;
+
+	bool operator==(const FAccelByteCacheKey& Other) const { return High == Other.High && Low == Other.Low; }
+	bool operator!=(const FAccelByteCacheKey& Other) const { return !(*this == Other); }
+
+	/**
+	* @brief Hex representation, used as the key of the persistent storages
+	*/
+	FString ToString() const { return FString::Printf(TEXT("%016llx%016llx"), High, Low); }
+
+	/**
+	* @brief Parse the hex representation written by ToString
+	*
+	* @return False if the string is not a key, e.g. an entry written by a previous format
+	*/
+	static bool Parse(const FString& Hex, FAccelByteCacheKey& OutKey)
+	{
+		if (Hex.Len() != 32)
+		{
+			return false;
+		}
+		for (const TCHAR Char : Hex)
+		{
+			if (!FChar::IsHexDigit(Char))
+			{
+				return false;
+			}
+		}
+		OutKey.High = FCString::Strtoui64(*Hex.Left(16), nullptr, 16);
+		OutKey.Low = FCString::Strtoui64(*Hex.Right(16), nullptr, 16);
+		return true;
+	}
+
+	/**
+	* @brief Build the key from the first 128 bits of the SHA-1 digest of the bytes
+	*/
+	static FAccelByteCacheKey FromBytes(const uint8* Data, int64 Size)
+	{
+		uint8 Digest[FSHA1::DigestSize];
+		FSHA1::HashBuffer(Data, static_cast<uint64>(Size), Digest);
+
+		FAccelByteCacheKey Key;
+		for (int32 Index = 0; Index < 8; Index++)
+		{
+			Key.High = Key.High << 8 | Digest[Index];
+			Key.Low = Key.Low << 8 | Digest[Index + 8];
+		}
+		return Key;
+	}
+
+	friend uint32 GetTypeHash(const FAccelByteCacheKey& Key)
+	{
+		// The bits are already uniformly distributed
+		return static_cast<uint32>(Key.Low);
+	}
+};
+
 template <typename T>
 struct FAccelByteCacheWrapper
 {
-	FName Key{};
+	FAccelByteCacheKey Key{};
 	TSharedPtr<T> Data = nullptr;
 	size_t Length = 0;
 };
@@ -31,36 +97,90 @@ protected:
 
 	bool bIsInitialized = false;
 
-	TArray<FAccelByteCacheWrapper<T>> ChunkArray;
+	typedef typename TDoubleLinkedList<FAccelByteCacheWrapper<T>>::TDoubleLinkedListNode FChunkNode;
+
+	/** Chunks ordered from the most to the least recently used. */
 	TDoubleLinkedList<FAccelByteCacheWrapper<T>> ChunkDll;
 
+	/** Index from the key to its node in ChunkDll, so find, promote and evict don't walk the list. */
+	TMap<FAccelByteCacheKey, FChunkNode*> ChunkMap;
+
+	/** Sum of the chunk lengths and the entries evicted to make room, by the limit that was reached. */
+	size_t ResidentBytes = 0;
+	int64 CountEvictionNum = 0;
+	int64 SizeEvictionNum = 0;
+
 #pragma region DOUBLE_LINKED_LIST
 public:
-	typename TDoubleLinkedList<FAccelByteCacheWrapper<T>>::TDoubleLinkedListNode* DLLGetTail() { return ChunkDll.GetTail(); }
-	typename TDoubleLinkedList<FAccelByteCacheWrapper<T>>::TDoubleLinkedListNode* DLLGetHead() { return ChunkDll.GetHead(); }
+	FChunkNode* DLLGetTail() { return ChunkDll.GetTail(); }
+	FChunkNode* DLLGetHead() { return ChunkDll.GetHead(); }
 private:
 	void DLLSetEmpty() { ChunkDll.Empty(); }
 	int DLLGetSize() { return ChunkDll.Num(); }
 	void DLLAddHead(FAccelByteCacheWrapper<T> NewHead) { ChunkDll.AddHead(NewHead); }
-	void DLLRemoveNode(typename TDoubleLinkedList<FAccelByteCacheWrapper<T>>::TDoubleLinkedListNode* Removed) { ChunkDll.RemoveNode(Removed); }
-	void DLLRemoveNode(typename TDoubleLinkedList<FAccelByteCacheWrapper<T>>::TDoubleLinkedListNode* Removed, bool bDeleteNode) { ChunkDll.RemoveNode(Removed, bDeleteNode); }
+	void DLLRemoveNode(FChunkNode* Removed, bool bDeleteNode = true) { ChunkDll.RemoveNode(Removed, bDeleteNode); }
+
+	/**
+	* @brief Move a node to the head without reallocating it
+	*/
+	void DLLMoveToHead(FChunkNode* Node)
+	{
+		if (Node != ChunkDll.GetHead())
+		{
+			ChunkDll.RemoveNode(Node, false);
+			ChunkDll.AddHead(Node);
+		}
+	}
 #pragma endregion
 
-#pragma region ARRAY_CONTAINER
+#pragma region MAP_CONTAINER
 protected:
-	int ArrayGetNum() { return ChunkArray.Num(); }
-	FAccelByteCacheWrapper<T>& ArrayGetIndex(int Index) { return ChunkArray[Index]; }
-private:
-	void ArraySetEmpty() { ChunkArray.Empty(); }
-	void ArrayRemoveAt(int Index) { ChunkArray.RemoveAt(Index); }
-	void ArrayAdd(const FAccelByteCacheWrapper<T>* Entry)
+	int32 ChunkGetNum() const { return ChunkMap.Num(); }
+
+	/**
+	* @brief Find the chunk of the storage Key
+	*
+	* @param Key Identifier of the data
+	* @return Pointer to the chunk if it exists, otherwise return nullptr.
+	*/
+	FAccelByteCacheWrapper<T>* FindChunk(const FAccelByteCacheKey& Key)
+	{
+		FChunkNode* const* Node = ChunkMap.Find(Key);
+		return Node != nullptr ? &(*Node)->GetValue() : nullptr;
+	}
+
+	/**
+	* @brief Add a chunk recovered from a persistent storage as the most recently used one
+	*/
+	void RestoreChunk(const FAccelByteCacheWrapper<T>& Chunk)
+	{
+		ChunkDll.AddHead(Chunk);
+		ChunkMap.Add(Chunk.Key, ChunkDll.GetHead());
+		ResidentBytes += Chunk.Length;
+	}
+
+	/**
+	* @brief Remove the least recently used chunk to make room
+	*
+	* @param bIsCountLimit True if the entry count limit is reached, otherwise the size limit is
+	* @return False if there is nothing left to evict
+	*/
+	bool EvictTail(bool bIsCountLimit)
 	{
-		if (Entry == nullptr)
+		FChunkNode* Tail = ChunkDll.GetTail();
+		if (Tail == nullptr)
 		{
-			return;
+			return false;
 		}
-		ChunkArray.Add(*Entry);
-	};
+
+		++(bIsCountLimit ? CountEvictionNum : SizeEvictionNum);
+
+		// Copied, the tail node holding the key is deleted by Remove
+		const FAccelByteCacheKey TailKey = Tail->GetValue().Key;
+		return Remove(TailKey);
+	}
+private:
+	void MapSetEmpty() { ChunkMap.Empty(); }
 #pragma endregion
 
 /**
@@ -78,7 +198,7 @@ protected:
 	* @brief LRUMemory: Clean memory specific key
 	* @brief LRUFileCache: Cleanup specific file for this key
 	*/
-	virtual void RemoveCache(const FName& Key) = 0;
+	virtual void RemoveCache(const FAccelByteCacheKey& Key) = 0;
 
 	/**
 	* @brief Ensure that we can free up the space before we insert to cache
@@ -92,7 +212,7 @@ protected:
 	* 
 	* @return Pointer to the FAccelByteCacheWrapper (LRU Memory)
 	*/
-	virtual inline const FAccelByteCacheWrapper<T>* InsertToCache(T& Item, const FName& Key) = 0;
+	virtual inline const FAccelByteCacheWrapper<T>* InsertToCache(T& Item, const FAccelByteCacheKey& Key) = 0;
 
 #pragma endregion
 
@@ -108,11 +228,16 @@ public:
 	* @param Key Identifier of the data
 	* @return True if the key is found
 	*/
-	inline bool Contains(const FName& Key)
+	inline bool Contains(const FAccelByteCacheKey& Key)
 	{
-		return FindIndex(Key) >= 0;
+		return ChunkMap.Contains(Key);
 	}
 
+	/**
+	* @brief Write the pending state of a persistent storage, so it can be recovered in the next session
+	*/
+	virtual void Flush() {}
+
 	/**
 	* @brief Cleanup the LRU storage and the Memory class
 	*/
@@ -120,10 +245,16 @@ public:
 	{
 		this->bIsInitialized = false;
 		FreeCache();
-		ArraySetEmpty();
+		MapSetEmpty();
 		DLLSetEmpty();
+		ResidentBytes = 0;
 	}
 
+	int32 GetEntryNum() const { return ChunkMap.Num(); }
+	size_t GetResidentBytes() const { return ResidentBytes; }
+	int64 GetCountEvictionNum() const { return CountEvictionNum; }
+	int64 GetSizeEvictionNum() const { return SizeEvictionNum; }
+
 	/**
 	* @brief Remove a data from the LRU class
 	*
@@ -131,19 +262,24 @@ public:
 	* @return True if the deleted data exist
 	* @return True if the removal success
 	*/
-	inline bool Remove(const FName& Key)
+	inline bool Remove(const FAccelByteCacheKey& Key)
 	{
-		int Index = FindIndex(Key);
-		auto* Node = DLLFindNode(Key);
+		// The key might live in the node that is deleted below
+		const FAccelByteCacheKey KeyCopy = Key;
 
-		if (Index >= 0 && Node != nullptr)
+		FChunkNode** Node = ChunkMap.Find(KeyCopy);
+		if (Node == nullptr)
 		{
-			RemoveCache(Key);
-			ArrayRemoveAt(Index);
-			DLLRemoveNode(Node, true);
-			return true;
+			return false;
 		}
-		return false;
+
+		// The cache might still need the chunk info to clean up
+		RemoveCache(KeyCopy);
+		ResidentBytes -= (*Node)->GetValue().Length;
+		FChunkNode* RemovedNode = *Node;
+		ChunkMap.Remove(KeyCopy);
+		DLLRemoveNode(RemovedNode, true);
+		return true;
 	}
 
 	/**
@@ -152,7 +288,7 @@ public:
 	* @param Key Identifier of the data
 	* @return True if the key is found
 	*/
-	inline bool Emplace(const FName& Key, T& Item)
+	inline bool Emplace(const FAccelByteCacheKey& Key, T& Item)
 	{
 		//// Check and remove an existing key that will be overwritten
 		Remove(Key);
@@ -168,8 +304,9 @@ public:
 		{
 			return false;
 		}
-		ArrayAdd(Result);
 		DLLAddHead(*Result);
+		ChunkMap.Add(Key, DLLGetHead());
+		ResidentBytes += Result->Length;
 		return true;
 	}
 
@@ -181,31 +318,26 @@ public:
 	* @param bPeekOnly If TRUE, does not affect the order.
 	* @return Pointer to the data. Nullptr if the data is not found.
 	*/
-	inline TSharedPtr<T> Find(const FName& Key, bool bPeekOnly = false)
+	inline TSharedPtr<T> Find(const FAccelByteCacheKey& Key, bool bPeekOnly = false)
 	{
-		int Index = FindIndex(Key);
-		if (Index < 0) { return nullptr; }
+		FChunkNode** Node = ChunkMap.Find(Key);
+		if (Node == nullptr) { return nullptr; }
 
 		if (!bPeekOnly)
 		{
-			auto* Node = DLLFindNode(Key);
-			if (Node == nullptr) { return nullptr; }
-
-			// Swap the position
-			DLLRemoveNode(Node);
-			DLLAddHead(ArrayGetIndex(Index));
+			DLLMoveToHead(*Node);
 		}
 
-		return GetTheValueFromChunkArray(Index);
+		return GetTheValueFromChunk((*Node)->GetValue());
 	}
 
-	inline TSharedPtr<T> operator[](const FName& Key)
+	inline TSharedPtr<T> operator[](const FAccelByteCacheKey& Key)
 	{
 		return Find(Key);
 	}
 
 	//LRUCacheFile should override this function
-	virtual inline TSharedPtr<T> GetTheValueFromChunkArray(int Index){ return ArrayGetIndex(Index).Data; }
+	virtual inline TSharedPtr<T> GetTheValueFromChunk(FAccelByteCacheWrapper<T>& Chunk) { return Chunk.Data; }
 
 	/**
 	* @brief Check the value only, does not affect the order of the linked list
@@ -213,51 +345,7 @@ public:
 	* @param Key Identifier of the data
 	* @return Pointer to the data. Nullptr if the data is not found.
 	*/
-	inline TSharedPtr<T> Peek(const FName& Key) { return Find(Key, true); }
-
-protected:
-
-	/**
-	* @brief Find the index of the ChunkArray based on the storage Key
-	*
-	* @param Key Identifier of the data
-	* @return Index number if it exists, otherwise return -1.
-	*/
-	inline int FindIndex(const FName& Key)
-	{
-		int Num = ArrayGetNum();
-		for (int i = 0; i < Num; i++)
-		{
-			if (ArrayGetIndex(i).Key.IsEqual(Key, ENameCase::CaseSensitive, true))
-			{
-				return i;
-			}
-		}
-		return -1;
-	}
-
-	/**
-	* @brief Find the pointer of the ChunkDLL's node based on the storage Key
-	*
-	* @param Key Identifier of the data
-	* @return Pointer to node if it exists, otherwise return nullptr.
-	*/
-	virtual inline typename TDoubleLinkedList<FAccelByteCacheWrapper<T>>::TDoubleLinkedListNode* DLLFindNode(const FName& Key)
-	{
-		auto* Node = DLLGetHead();
-
-		while (Node != nullptr)
-		{
-			if (Node->GetValue().Key == Key)
-			{
-				break;
-			}
-
-			Node = Node->GetNextNode();
-		}
-
-		return Node;
-	}
+	inline TSharedPtr<T> Peek(const FAccelByteCacheKey& Key) { return Find(Key, true); }
 
 public:
 
@@ -279,6 +367,17 @@ inline const size_t FAccelByteLRUCache<FHttpRequestPtr>::GetRequiredSize(FHttpRe
 	return Output;
 }
 
+// Override specific for cached HTTP response size, a rebuilt item only has the serialized payload
+template<>
+inline const size_t FAccelByteLRUCache<FAccelByteHttpCacheItem>::GetRequiredSize(FAccelByteHttpCacheItem& Data)
+{
+	if (Data.Request.IsValid() && Data.Request->GetResponse().IsValid())
+	{
+		return FAccelByteLRUCache<FHttpRequestPtr>::GetRequiredSize(Data.Request);
+	}
+	return Data.SerializableRequestAndResponse.ResponsePayload.Num();
+}
+
 // Override specific for FString size
 template<>
 inline const size_t FAccelByteLRUCache<FString>::GetRequiredSize(FString& Data)
@@ -45,7 +45,7 @@ private:
 	
 	DataStorageBinaryFile DataStorage;
 
-	TArray<FAccelByteCacheWrapper<T>> DerivedChunkArray;
+	TMap<FAccelByteCacheKey, FAccelByteCacheWrapper<T>> DerivedChunks;
 
 	/**
 	* @brief Initialize the Storage
@@ -72,7 +72,7 @@ private:
 		return Directory.Path + Filename;
 	}
 
-	FString ConvertKeyToFilename(const FName& Key) { return ConvertKeyToFilename(Key.ToString()); }
+	FString ConvertKeyToFilename(const FAccelByteCacheKey& Key) { return ConvertKeyToFilename(Key.ToString()); }
 
 	/**
 	* @brief Get All files from data storage binary class directory
@@ -97,26 +97,20 @@ private:
 
 		CurrentFileCount = 0;
 		CurrentFileSizeBytes = 0;
-		DerivedChunkArray.Empty();
+		DerivedChunks.Empty();
 	}
 
-	inline void RemoveCache(const FName& Key) override
+	inline void RemoveCache(const FAccelByteCacheKey& Key) override
 	{
-		auto Filename = ConvertKeyToFilename(Key);
-		size_t CurrentSize = this->ArrayGetIndex(this->FindIndex(Key)).Length;
+		auto AbsPath = CompleteFilenameToAbsolute(ConvertKeyToFilename(Key));
+		const FAccelByteCacheWrapper<T>* Chunk = this->FindChunk(Key);
+		size_t CurrentSize = Chunk != nullptr ? Chunk->Length : 0;
 		
-		IFileManager::Get().Delete(*Filename, true, true, true);
+		IFileManager::Get().Delete(*AbsPath, true, true, true);
 		CurrentFileCount -= 1;
 		CurrentFileSizeBytes -= CurrentSize;
 
-		for (int i = 0; i < DerivedChunkArray.Num(); i++)
-		{
-			if (DerivedChunkArray[i].Key == Key)
-			{
-				DerivedChunkArray.RemoveAt(i);
-			}
-		}
-
+		DerivedChunks.Remove(Key);
 	}
 
 	inline bool FreeCacheBeforeInsertion(T& Item) override
@@ -132,19 +126,19 @@ private:
 		}
 
 		auto Node = this->DLLGetTail();
-		while (Node != nullptr && (Required > Left || this->ArrayGetNum() >= MaxFileCount))
+		while (Node != nullptr && (Required > Left || this->ChunkGetNum() >= MaxFileCount))
 		{
 			size_t TailSize = Node->GetValue().Length;
-			this->Remove(this->DLLGetTail()->GetValue().Key);
+			this->EvictTail(this->ChunkGetNum() >= MaxFileCount);
 			Left += TailSize;
 			Node = this->DLLGetTail();
 		}
 
 		size_t ModifiedStorageSizeLeft = MaxFileSizeBytes - CurrentFileSizeBytes;
-		return (Required <= ModifiedStorageSizeLeft) && (this->ArrayGetNum() < MaxFileCount);
+		return (Required <= ModifiedStorageSizeLeft) && (this->ChunkGetNum() < MaxFileCount);
 	}
 
-	inline const FAccelByteCacheWrapper<T>* InsertToCache(T& Item, const FName& Key) override
+	inline const FAccelByteCacheWrapper<T>* InsertToCache(T& Item, const FAccelByteCacheKey& Key) override
 	{
 		if (!InsertPrerequisiteOkay())
 		{
@@ -164,11 +158,11 @@ private:
 		bool bIsSuccess = FFileHelper::SaveArrayToFile(ArrayByte, *AbsPath);
 		
 		if (!bIsSuccess) return nullptr;
-		int Index = DerivedChunkArray.Add(Result);
+		FAccelByteCacheWrapper<T>& Chunk = DerivedChunks.Add(Key, Result);
 		CurrentFileCount += 1;
 		CurrentFileSizeBytes += Result.Length;
 
-		return &DerivedChunkArray[Index];
+		return &Chunk;
 	}
 
 	inline bool InsertPrerequisiteOkay() 
@@ -187,9 +181,8 @@ private:
 	inline const TArray<uint8> ToArrayByte(T& Item) { return TArray<uint8>(); }
 	inline TSharedPtr<T> FromFString(const FString& Content) { return nullptr; };
 
-	inline TSharedPtr<T> GetTheValueFromChunkArray(int Index) override
+	inline TSharedPtr<T> GetTheValueFromChunk(FAccelByteCacheWrapper<T>& ChunkInfo) override
 	{
-		FAccelByteCacheWrapper<T>& ChunkInfo = this->ArrayGetIndex(Index);
 		FString Key = ChunkInfo.Key.ToString();
 
 		TArray<uint8> ArrayByte;
@@ -26,7 +26,7 @@ public:
 	inline FAccelByteLRUCacheMemory(MemoryConstructionParameter Param)
 	{
 		MemoryParameter = Param;
-		FAccelByteLRUCacheMemory();
+		InitializeMemory();
 	}
 
 	inline ~FAccelByteLRUCacheMemory()
@@ -50,7 +50,7 @@ private:
 		Memory->RemoveAll();
 	}
 
-	inline void RemoveCache(const FName& Key) override
+	inline void RemoveCache(const FAccelByteCacheKey& Key) override
 	{
 		if (Memory == nullptr) { InitializeMemory(); }
 		Memory->Remove(Key);
@@ -60,10 +60,11 @@ private:
 	{
 		if (Memory == nullptr) { InitializeMemory(); }
 
-		auto Required = this->GetRequiredSize(Item);
+		// Sized the way the memory charges it, the pool allocation reserves whole slots for the serialized item
+		const size_t Required = Memory->GetRequiredSize(Item);
 		size_t Left = Memory->GetMemoryPoolLeft();
 
-		bool bChunkCountIsSafe = this->ArrayGetNum() < MemoryParameter.ChunkCount;
+		bool bChunkCountIsSafe = this->ChunkGetNum() < MemoryParameter.ChunkCount;
 
 		if (Left >= Required && bChunkCountIsSafe)
 		{
@@ -71,25 +72,41 @@ private:
 		}
 
 		auto Node = this->DLLGetTail();
-		while (Node != nullptr && (Required > Left || this->ArrayGetNum() >= MemoryParameter.ChunkCount))
+		while (Node != nullptr && (Required > Left || this->ChunkGetNum() >= MemoryParameter.ChunkCount))
 		{
 			size_t TailSize = Node->GetValue().Length;
-			this->Remove(this->DLLGetTail()->GetValue().Key);
+			this->EvictTail(this->ChunkGetNum() >= MemoryParameter.ChunkCount);
 			Left += TailSize;
 			Node = this->DLLGetTail();
 		}
 
-		return (this->GetRequiredSize(Item) <= Memory->GetMemoryPoolLeft()) && (this->ArrayGetNum() < MemoryParameter.ChunkCount);
+		return (Required <= Memory->GetMemoryPoolLeft()) && (this->ChunkGetNum() < MemoryParameter.ChunkCount);
 	}
 
-	inline const FAccelByteCacheWrapper<T>* InsertToCache(T& Item, const FName& Key) override
+	inline const FAccelByteCacheWrapper<T>* InsertToCache(T& Item, const FAccelByteCacheKey& Key) override
 	{
 		if (Memory == nullptr) { InitializeMemory(); }
 		const FChunkInfo<T>* InsertResult = (Memory->Insert(Item, Key));
 		return static_cast<const FAccelByteCacheWrapper<T>*>(InsertResult);
 	}
 
+	/**
+	* @brief The pool allocation keeps no object in the chunk, the value is rebuilt from the arena.
+	* The latest rebuilt value is held so the pointer handed out stays valid until the next lookup.
+	*/
+	inline TSharedPtr<T> GetTheValueFromChunk(FAccelByteCacheWrapper<T>& Chunk) override
+	{
+		if (Chunk.Data.IsValid())
+		{
+			return Chunk.Data;
+		}
+		if (Memory == nullptr) { InitializeMemory(); }
+		LastRetrievedValue = Memory->Get(Chunk.Key);
+		return LastRetrievedValue;
+	}
+
 	TSharedPtr<FAccelByteMemory<T>> Memory;
+	TSharedPtr<T> LastRetrievedValue;
 	MemoryConstructionParameter MemoryParameter = { MemoryMethod::Dynamic, this->MAX_HTTP_LRU_CACHE_SIZE, this->MAX_HTTP_LRU_CACHE_COUNT };
 };
 }
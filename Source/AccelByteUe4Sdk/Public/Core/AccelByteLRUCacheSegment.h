@@ -0,0 +1,158 @@
+// Copyright (c) 2022 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/AccelByteCacheItemSerializer.h"
+#include "Core/AccelByteCacheSegmentStore.h"
+#include "Core/AccelByteDataStorageBinaryFile.h"
+#include "Core/AccelByteLRUCache.h"
+
+namespace AccelByte
+{
+namespace Core
+{
+
+/**
+ * @brief LRU cache persisted in a single segment file, the entries of the previous session are recovered on construction.
+ * The recovered entries are ordered by their last write, the latest written being the most recently used.
+ */
+template <typename T>
+class FAccelByteLRUCacheSegment : public FAccelByteLRUCache<T>
+{
+public:
+	const FString STORE_NAME = TEXT("AccelByteHttpCache");
+
+	inline FAccelByteLRUCacheSegment()
+		: Store(DataStorageBinaryFile().GetAbsoluteFileDirectory().Path, STORE_NAME)
+	{
+		InitializeStorage();
+	}
+
+	inline FAccelByteLRUCacheSegment(int32 MaxEntryCount_, size_t MaxSizeBytes_, const FString& StoreName = TEXT("AccelByteHttpCache"))
+		: MaxEntryCount(MaxEntryCount_)
+		, MaxSizeBytes(MaxSizeBytes_)
+		, Store(DataStorageBinaryFile().GetAbsoluteFileDirectory().Path, StoreName)
+	{
+		InitializeStorage();
+	}
+
+	inline ~FAccelByteLRUCacheSegment()
+	{
+		Store.Close();
+	}
+
+	inline void Flush() override
+	{
+		Store.Flush();
+	}
+
+private:
+	int32 MaxEntryCount = 100;
+	size_t MaxSizeBytes = 10 * 1024 * 1024;
+	size_t CurrentSizeBytes = 0;
+
+	FAccelByteCacheSegmentStore Store;
+	TArray<uint8> ScratchBuffer;
+	TSharedPtr<T> LastRetrievedValue;
+
+	/**
+	* @brief Open the store and rebuild the LRU order from the recovered entries
+	*/
+	inline void InitializeStorage()
+	{
+		TArray<FAccelByteCacheSegmentStore::FRecoveredEntry> RecoveredEntries;
+		Store.Open(RecoveredEntries);
+
+		for (const FAccelByteCacheSegmentStore::FRecoveredEntry& Entry : RecoveredEntries)
+		{
+			FAccelByteCacheKey Key;
+			if (!FAccelByteCacheKey::Parse(Entry.Key, Key))
+			{
+				// Written with a different key format, it can never be looked up again
+				Store.Remove(Entry.Key);
+				continue;
+			}
+			this->RestoreChunk(FAccelByteCacheWrapper<T>{ Key, nullptr, static_cast<size_t>(Entry.Size) });
+			CurrentSizeBytes += Entry.Size;
+		}
+
+		// The limits might be lowered since the previous session
+		while (this->DLLGetTail() != nullptr && (CurrentSizeBytes > MaxSizeBytes || this->ChunkGetNum() > MaxEntryCount))
+		{
+			this->EvictTail(this->ChunkGetNum() > MaxEntryCount);
+		}
+
+		this->bIsInitialized = true;
+	}
+
+	inline void FreeCache() override
+	{
+		Store.Clear();
+		CurrentSizeBytes = 0;
+		LastRetrievedValue.Reset();
+	}
+
+	inline void RemoveCache(const FAccelByteCacheKey& Key) override
+	{
+		const FAccelByteCacheWrapper<T>* Chunk = this->FindChunk(Key);
+		CurrentSizeBytes -= Chunk != nullptr ? Chunk->Length : 0;
+		Store.Remove(Key.ToString());
+	}
+
+	inline bool FreeCacheBeforeInsertion(T& Item) override
+	{
+		// The item is serialized here so the exact size is known before evicting
+		ScratchBuffer.Reset();
+		if (!TAccelByteCacheItemSerializer<T>::Serialize(Item, ScratchBuffer, true))
+		{
+			return false;
+		}
+
+		const size_t Required = ScratchBuffer.Num();
+		auto Node = this->DLLGetTail();
+		while (Node != nullptr && (CurrentSizeBytes + Required > MaxSizeBytes || this->ChunkGetNum() >= MaxEntryCount))
+		{
+			this->EvictTail(this->ChunkGetNum() >= MaxEntryCount);
+			Node = this->DLLGetTail();
+		}
+
+		return (CurrentSizeBytes + Required <= MaxSizeBytes) && (this->ChunkGetNum() < MaxEntryCount);
+	}
+
+	inline const FAccelByteCacheWrapper<T>* InsertToCache(T& Item, const FAccelByteCacheKey& Key) override
+	{
+		// FreeCacheBeforeInsertion left the serialized item in the scratch buffer
+		if (ScratchBuffer.Num() == 0 || !Store.Put(Key.ToString(), ScratchBuffer))
+		{
+			return nullptr;
+		}
+
+		InsertedChunk = FAccelByteCacheWrapper<T>{ Key, nullptr, static_cast<size_t>(ScratchBuffer.Num()) };
+		CurrentSizeBytes += InsertedChunk.Length;
+		ScratchBuffer.Reset();
+
+		return &InsertedChunk;
+	}
+
+	/**
+	* @brief The value is read back from the segment, the latest one is held so the pointer handed out stays valid.
+	*/
+	inline TSharedPtr<T> GetTheValueFromChunk(FAccelByteCacheWrapper<T>& Chunk) override
+	{
+		if (!Store.Get(Chunk.Key.ToString(), ScratchBuffer))
+		{
+			return nullptr;
+		}
+		LastRetrievedValue = TAccelByteCacheItemSerializer<T>::Deserialize(ScratchBuffer, true);
+		ScratchBuffer.Reset();
+		return LastRetrievedValue;
+	}
+
+	FAccelByteCacheWrapper<T> InsertedChunk;
+};
+
+}
+}
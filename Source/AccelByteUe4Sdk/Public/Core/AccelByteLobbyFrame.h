@@ -0,0 +1,108 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StringView.h"
+#include "Dom/JsonObject.h"
+
+namespace AccelByte
+{
+
+/**
+ * @brief Lobby frame split into its `key: value` lines in a single pass.
+ * The lines are sliced on demand, so reading the header fields doesn't touch the body.
+ * The fields are slices of the message, which must outlive the frame.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteLobbyFrame
+{
+public:
+	struct FField
+	{
+		FStringView Name;
+
+		// Trimmed raw value, quotes and escapes are kept
+		FStringView Value;
+	};
+
+	using FFieldArray = TArray<FField, TInlineAllocator<16>>;
+
+	explicit FAccelByteLobbyFrame(const FString& InMessage);
+	FAccelByteLobbyFrame(FString&&) = delete;
+
+	const FString& GetMessage() const { return Message; }
+
+	/**
+	 * @brief Get every field of the frame, slicing the rest of the message if needed
+	 */
+	const FFieldArray& GetFields() const;
+
+	/**
+	 * @brief Find the raw value of a field, the name is compared case-insensitively like the JSON keys are
+	 *
+	 * @return false if the frame doesn't have the field
+	 */
+	bool TryGetField(const TCHAR* Name, FStringView& OutValue) const;
+
+	/**
+	 * @brief Get the unquoted and unescaped value of a field, empty if the frame doesn't have it
+	 */
+	FString GetStringField(const TCHAR* Name) const;
+
+	int32 GetIntegerField(const TCHAR* Name) const;
+
+	/**
+	 * @brief Convert the frame to a JSON object string, for the handlers that need the whole message as JSON
+	 */
+	FString ToJsonString() const;
+
+	/**
+	 * @brief Parse the JSON conversion of the frame, nullptr if it is not valid JSON
+	 */
+	TSharedPtr<FJsonObject> ToJsonObject() const;
+
+private:
+	bool ParseNextField() const;
+
+	const FString& Message;
+
+	// Fields sliced so far, and where the next line starts
+	mutable FFieldArray Fields;
+	mutable const TCHAR* ParseCursor;
+};
+
+/**
+ * @brief Populate a USTRUCT straight from the fields of a lobby frame, without converting the frame to JSON first.
+ * The fields are matched to the properties by name like FJsonObjectConverter does, and an unknown enum value is
+ * set to the first value like FAccelByteJsonConverter does. Only the object values, and the arrays of objects,
+ * go through a JSON conversion of their own.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteLobbyFrameDecoder
+{
+public:
+	template <typename OutStructType>
+	static bool Decode(const FAccelByteLobbyFrame& Frame, OutStructType& OutStruct)
+	{
+		return DecodeStruct(Frame, OutStructType::StaticStruct(), &OutStruct);
+	}
+
+	/**
+	 * @return false if a field can't be converted to its property, the other properties are still set
+	 */
+	static bool DecodeStruct(const FAccelByteLobbyFrame& Frame, const UStruct* Definition, void* OutStruct);
+
+	/**
+	 * @brief Remove the surrounding quotes of a scalar value and resolve its JSON escapes
+	 */
+	static FString UnquoteValue(FStringView Value);
+
+private:
+	static bool DecodeProperty(FProperty* Property, FStringView Value, void* OutValue);
+	static bool DecodeScalar(FProperty* Property, FStringView Value, void* OutValue);
+	static bool DecodeArray(FArrayProperty* ArrayProperty, FStringView Value, void* OutValue);
+	static bool DecodeAsJson(FProperty* Property, FStringView Value, void* OutValue);
+};
+
+}
@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "HttpManager.h"
 #include "Interfaces/IHttpResponse.h"
+#include "Core/AccelByteCacheItemSerializer.h"
 #include "Core/AccelByteLRUCache.h"
 #include "Models/AccelByteGeneralModels.h"
 
@@ -27,6 +28,9 @@ struct FChunkInfo : public FAccelByteCacheWrapper<T>
 {
 public:
 	FAccelByteMemory<T>* Pool = nullptr;
+
+	// Entry of the data inside the slab arena, only used by the pool allocation
+	int32 Handle = INDEX_NONE;
 };
 
 
@@ -45,6 +49,165 @@ struct MemoryConstructionParameter
 };
 
 
+/**
+ * @brief Usage and throughput counters of the slab arena behind the pool allocation.
+ */
+struct FAccelByteMemoryPoolStats
+{
+	// Bytes that can be handed out, the arena never grows beyond this
+	size_t CapacityBytes = 0;
+
+	// Bytes of the stored data
+	size_t UsedBytes = 0;
+
+	// Bytes of the slots holding the stored data, including the unused tail of each slot
+	size_t ReservedBytes = 0;
+
+	int32 EntryNum = 0;
+	int32 PageNum = 0;
+	int32 FreePageNum = 0;
+
+	uint64 AllocationNum = 0;
+	uint64 FailedAllocationNum = 0;
+	uint64 FreeNum = 0;
+	uint64 CompactionNum = 0;
+	uint64 MovedSlotNum = 0;
+
+	uint64 WrittenBytes = 0;
+	uint64 ReadBytes = 0;
+	double WriteSeconds = 0.0;
+	double ReadSeconds = 0.0;
+
+	/**
+	 * @brief Ratio of the reserved bytes that are not used by the stored data, 0 when nothing is reserved.
+	 */
+	double GetInternalFragmentation() const
+	{
+		return ReservedBytes > 0 ? 1.0 - (double(UsedBytes) / double(ReservedBytes)) : 0.0;
+	}
+
+	/**
+	 * @brief Ratio of the pages assigned to a size class that are not filled by reserved slots.
+	 */
+	double GetExternalFragmentation(uint32 PageSize) const
+	{
+		const size_t AssignedBytes = size_t(PageNum - FreePageNum) * PageSize;
+		return AssignedBytes > 0 ? 1.0 - (double(ReservedBytes) / double(AssignedBytes)) : 0.0;
+	}
+
+	double GetWriteThroughput() const { return WriteSeconds > 0.0 ? WrittenBytes / WriteSeconds : 0.0; }
+	double GetReadThroughput() const { return ReadSeconds > 0.0 ? ReadBytes / ReadSeconds : 0.0; }
+};
+
+
+/**
+ * @brief Fixed budget arena split into pages, each page is carved into slots of a single size class.
+ * Data larger than the biggest class is stored as a chain of slots, the tail going to the smallest class that fits.
+ * The arena is allocated once and never grows, the bookkeeping lives outside of it.
+ */
+class ACCELBYTEUE4SDK_API FAccelByteSlabArena
+{
+public:
+	static constexpr int32 SizeClassNum = 7;
+	static constexpr uint32 MinSlotSize = 256;
+	static constexpr uint32 MaxSlotSize = MinSlotSize << (SizeClassNum - 1);
+	static constexpr uint32 DefaultPageSize = 64 * 1024;
+
+	FAccelByteSlabArena(size_t InPoolSize, uint32 InPageSize = DefaultPageSize);
+	~FAccelByteSlabArena();
+
+	FAccelByteSlabArena(const FAccelByteSlabArena&) = delete;
+	FAccelByteSlabArena& operator=(const FAccelByteSlabArena&) = delete;
+
+	/**
+	 * @brief Copy the data into the arena, compacting the pages once if no slot is available.
+	 *
+	 * @return Handle of the entry, INDEX_NONE if the arena is full.
+	 */
+	int32 Allocate(const uint8* Data, int64 Size);
+
+	/**
+	 * @brief Copy the data of an entry out of the arena.
+	 */
+	bool Read(int32 Handle, TArray<uint8>& OutData);
+
+	void Free(int32 Handle);
+
+	/**
+	 * @brief Release every entry, the counters are kept.
+	 */
+	void Reset();
+
+	/**
+	 * @brief Move the slots of the sparsest pages into the densest pages of the same size class,
+	 * and hand the emptied pages back so any size class can use them.
+	 */
+	void Compact();
+
+	/**
+	 * @brief Bytes of the slots needed to store data of the given size.
+	 */
+	static size_t GetReservedSize(int64 Size);
+
+	size_t GetReservedSize(int32 Handle) const;
+	size_t GetCapacity() const { return Stats.CapacityBytes; }
+	uint32 GetPageSize() const { return PageSize; }
+	const FAccelByteMemoryPoolStats& GetStats() const { return Stats; }
+
+private:
+	struct FSlot
+	{
+		int32 Page = INDEX_NONE;
+		int32 Index = INDEX_NONE;
+	};
+
+	struct FSlotOwner
+	{
+		int32 Entry = INDEX_NONE;
+		int32 Segment = INDEX_NONE;
+	};
+
+	struct FPage
+	{
+		int32 SizeClass = INDEX_NONE;
+		int32 UsedSlotNum = 0;
+		bool bIsPartial = false;
+		TArray<int32> FreeSlots;
+		TArray<FSlotOwner> SlotOwners;
+	};
+
+	struct FEntry
+	{
+		bool bIsUsed = false;
+		int64 Size = 0;
+		TArray<FSlot, TInlineAllocator<8>> Segments;
+	};
+
+	static int32 GetSizeClass(int64 Size);
+	static uint32 GetSlotSize(int32 SizeClass) { return MinSlotSize << SizeClass; }
+
+	uint8* GetSlotData(const FSlot& Slot) const;
+	int32 AcquirePage(int32 SizeClass);
+	void ReleasePage(int32 PageIndex);
+	bool AllocateSlot(int32 SizeClass, const FSlotOwner& Owner, FSlot& OutSlot);
+	void FreeSlot(const FSlot& Slot);
+	void MoveSlot(int32 FromPage, int32 FromIndex, int32 ToPage);
+	void FreeEntry(int32 Handle);
+
+	uint8* Memory = nullptr;
+	uint32 PageSize = DefaultPageSize;
+
+	TArray<FPage> Pages;
+	TArray<int32> FreePages;
+	TArray<int32> PartialPages[SizeClassNum];
+
+	TArray<FEntry> Entries;
+	TArray<int32> FreeEntries;
+
+	FAccelByteMemoryPoolStats Stats;
+};
+
+
 template<typename T>
 class FAccelByteMemory
 {
@@ -60,7 +223,7 @@ public:
 	*
 	* @param Key Identifier of the data
 	*/
-	virtual void Remove(const FName& Key) = 0;
+	virtual void Remove(const FAccelByteCacheKey& Key) = 0;
 
 	/**
 	* @brief Insert data to the Memory class based on the specific key.
@@ -71,7 +234,15 @@ public:
 	* @param Key Identifier of the data
 	* @return The pointer of the ChunkInfo if success, otherwise nullptr will be returned
 	*/
-	virtual const FChunkInfo<T>* Insert(T& Data, const FName& Key) = 0;
+	virtual const FChunkInfo<T>* Insert(T& Data, const FAccelByteCacheKey& Key) = 0;
+
+	/**
+	* @brief Get the bytes the data will be charged once inserted, used to evict enough before the insertion.
+	*
+	* @param Data The reference to the object that is about to be inserted
+	* @return Size charged against the pool
+	*/
+	virtual size_t GetRequiredSize(T& Data) = 0;
 
 	/**
 	* @brief Get the stored data in the Memory class
@@ -79,7 +250,7 @@ public:
 	* @param Key Identifier of the data
 	* @return The pointer of the data if found, otherwise nullptr will be returned
 	*/
-	virtual const TSharedPtr<T> Get(const FName& Key) = 0;
+	virtual const TSharedPtr<T> Get(const FAccelByteCacheKey& Key) = 0;
 
 	inline const size_t GetCurrentMemoryPoolSize() { return CurrentMemoryPoolSize; }
 	inline const size_t GetMemoryPoolLeft() { return MemoryParameter.PoolSize - CurrentMemoryPoolSize; }
@@ -96,30 +267,21 @@ protected:
 	virtual ~FAccelByteMemory() {};
 
 	/**
-	* @brief Find the index of the ChunkList based on the storage Key
+	* @brief Find the chunk of the storage Key
 	*
 	* @param Key Identifier of the data
-	* @return Index number if it exists, otherwise return -1.
+	* @return Pointer to the chunk if it exists, otherwise return nullptr.
 	*/
-	inline const int32 FindIndexFromChunkList(const FName& Key)
+	inline FChunkInfo<T>* FindChunk(const FAccelByteCacheKey& Key)
 	{
-		int Index = -1;
-		for (int i = 0; i < ChunkList.Num(); i++)
-		{
-			if (ChunkList[i].Key == Key)
-			{
-				Index = i;
-			}
-		}
-
-		return Index;
+		return ChunkMap.Find(Key);
 	}
 
 	MemoryConstructionParameter MemoryParameter;
 	size_t CurrentMemoryPoolSize = 0;
 	int32 CurrentChunkCount = 0;
 	
-	TArray<FChunkInfo<T>> ChunkList;
+	TMap<FAccelByteCacheKey, FChunkInfo<T>> ChunkMap;
 };
 
 template<typename T>
@@ -146,77 +308,123 @@ class FAccelByteMemoryPoolAllocation : public FAccelByteMemory<T>
 {
 public:
 	FAccelByteMemoryPoolAllocation(size_t PoolSize_, int32 ChunkCount_)
+		: Arena(PoolSize_)
 	{
 		this->MemoryParameter.Method = MemoryMethod::PoolAllocation;
-		this->MemoryParameter.PoolSize = PoolSize_;
+		this->MemoryParameter.PoolSize = Arena.GetCapacity();
 		this->MemoryParameter.ChunkCount = ChunkCount_;
-		ReservedMemory = std::malloc(PoolSize_);
 	}
 
 	~FAccelByteMemoryPoolAllocation()
 	{
-		free(ReservedMemory);
-		this->ChunkList.Empty();
+		this->ChunkMap.Empty();
 	}
 
 	inline void RemoveAll() override
 	{
 		this->CurrentChunkCount = 0;
 		this->CurrentMemoryPoolSize = 0;
-		this->ChunkList.Empty();
+		this->ChunkMap.Empty();
+		Arena.Reset();
 	}
 
-	inline const FChunkInfo<T>* Insert(T& Data, const FName& Key) override
+	inline const FChunkInfo<T>* Insert(T& Data, const FAccelByteCacheKey& Key) override
 	{
-		if (this->ChunkList.Num() >= this->MemoryParameter.ChunkCount)
+		Remove(Key);
+
+		if (!InsertPrerequisiteOkay())
 		{
+			SerializedBuffer.Reset();
 			return nullptr;
 		}
-		// Store to the reserved memory 
-		return nullptr;
+
+		// GetRequiredSize normally left the serialized data behind, the buffer keeps its allocation once it has grown
+		if (SerializedBuffer.Num() == 0 && !TAccelByteCacheItemSerializer<T>::Serialize(Data, SerializedBuffer))
+		{
+			SerializedBuffer.Reset();
+			return nullptr;
+		}
+
+		const int32 Handle = Arena.Allocate(SerializedBuffer.GetData(), SerializedBuffer.Num());
+		SerializedBuffer.Reset();
+		if (Handle == INDEX_NONE)
+		{
+			return nullptr;
+		}
+
+		FChunkInfo<T>& Chunk = this->ChunkMap.Add(Key, FChunkInfo<T>{});
+		Chunk.Key = Key;
+		Chunk.Length = Arena.GetReservedSize(Handle);
+		Chunk.Pool = this;
+		Chunk.Handle = Handle;
+
+		this->CurrentChunkCount += 1;
+		this->CurrentMemoryPoolSize += Chunk.Length;
+
+		return &Chunk;
 	}
 
-	inline void Remove(const FName& Key) override
+	/**
+	 * @brief The data is serialized here so the arena charge is exact, the next insertion stores the same bytes.
+	 */
+	inline size_t GetRequiredSize(T& Data) override
 	{
-		auto Index = this->FindIndexFromChunkList(Key);
-		if (Index >= 0)
+		SerializedBuffer.Reset();
+		if (!TAccelByteCacheItemSerializer<T>::Serialize(Data, SerializedBuffer))
 		{
-			// deal with raw memory immediately
-			this->ChunkList.RemoveAt(Index);
+			SerializedBuffer.Reset();
+			return 0;
 		}
+		return FAccelByteSlabArena::GetReservedSize(SerializedBuffer.Num());
 	}
 
-	inline const TSharedPtr<T> Get(const FName& Key) override
+	inline void Remove(const FAccelByteCacheKey& Key) override
 	{
-		auto Index = this->FindIndexFromChunkList(Key);
-		if (Index >= 0)
+		FChunkInfo<T> Chunk;
+		if (this->ChunkMap.RemoveAndCopyValue(Key, Chunk))
 		{
-			return this->ChunkList[Index].Data;
+			Arena.Free(Chunk.Handle);
+			this->CurrentChunkCount -= 1;
+			this->CurrentMemoryPoolSize -= Chunk.Length;
 		}
-		return nullptr;
 	}
 
+	/**
+	 * @brief The data is rebuilt from the arena on every call, the caller owns the returned copy.
+	 */
+	inline const TSharedPtr<T> Get(const FAccelByteCacheKey& Key) override
+	{
+		const FChunkInfo<T>* Chunk = this->FindChunk(Key);
+		if (Chunk == nullptr || !Arena.Read(Chunk->Handle, ScratchBuffer))
+		{
+			return nullptr;
+		}
+		return TAccelByteCacheItemSerializer<T>::Deserialize(ScratchBuffer);
+	}
+
+	inline const FAccelByteMemoryPoolStats& GetStats() const { return Arena.GetStats(); }
+
+	inline void Defragment() { Arena.Compact(); }
+
 private:
 	inline bool InsertPrerequisiteOkay() override
 	{
-		if (this->ChunkList.Num() >= this->MemoryParameter.ChunkCount)
+		if (this->GetCurrentChunkCount() >= this->MemoryParameter.ChunkCount)
+		{
+			return false;
+		}
+		if (this->GetCurrentMemoryPoolSize() >= this->MemoryParameter.PoolSize)
 		{
 			return false;
 		}
-		// if (ReservedMemory is full)
-
 		return true;
 	}
 
-	//TODO void DefragmentMemory() = 0;
-
-	// Constructor don't forget to reserve based on the PoolSize byte
-	// Makeshareable for ChunkInfo
-
-	void* ReservedMemory;
+	FAccelByteSlabArena Arena;
+	TArray<uint8> ScratchBuffer;
+	TArray<uint8> SerializedBuffer;
 };
 
-
 template<typename T>
 class FAccelByteMemoryDynamicAllocation : public FAccelByteMemory<T>
 {
@@ -230,17 +438,17 @@ public:
 
 	~FAccelByteMemoryDynamicAllocation()
 	{
-		this->ChunkList.Empty();
+		this->ChunkMap.Empty();
 	}
 
 	inline void RemoveAll() override
 	{
 		this->CurrentChunkCount = 0;
 		this->CurrentMemoryPoolSize = 0;
-		this->ChunkList.Empty();
+		this->ChunkMap.Empty();
 	}
 
-	inline const FChunkInfo<T>* Insert(T& Data, const FName& Key) override
+	inline const FChunkInfo<T>* Insert(T& Data, const FAccelByteCacheKey& Key) override
 	{
 		if (!InsertPrerequisiteOkay())
 		{
@@ -253,32 +461,36 @@ public:
 		Result.Length = FAccelByteLRUCache<T>::GetRequiredSize(Data);
 		Result.Pool = this;
 
-		int Index = this->ChunkList.Add(Result);
-		Result.Length = FAccelByteLRUCache<T>::GetRequiredSize(*this->ChunkList[Index].Data);
+		FChunkInfo<T>& Chunk = this->ChunkMap.Add(Key, Result);
+		Chunk.Length = FAccelByteLRUCache<T>::GetRequiredSize(*Chunk.Data);
 
 		this->CurrentChunkCount += 1;
-		this->CurrentMemoryPoolSize += Result.Length;
+		this->CurrentMemoryPoolSize += Chunk.Length;
 
-		return &this->ChunkList[Index];
+		return &Chunk;
+	}
+
+	inline size_t GetRequiredSize(T& Data) override
+	{
+		return FAccelByteLRUCache<T>::GetRequiredSize(Data);
 	}
 
-	inline void Remove(const FName& Key) override
+	inline void Remove(const FAccelByteCacheKey& Key) override
 	{
-		auto Index = this->FindIndexFromChunkList(Key);
-		if (Index >= 0)
+		FChunkInfo<T> Chunk;
+		if (this->ChunkMap.RemoveAndCopyValue(Key, Chunk))
 		{
 			this->CurrentChunkCount -= 1;
-			this->CurrentMemoryPoolSize -= this->ChunkList[Index].Length;
-			this->ChunkList.RemoveAt(Index);
+			this->CurrentMemoryPoolSize -= Chunk.Length;
 		}
 	}
 
-	inline const TSharedPtr<T> Get(const FName& Key) override
+	inline const TSharedPtr<T> Get(const FAccelByteCacheKey& Key) override
 	{
-		auto Index = this->FindIndexFromChunkList(Key);
-		if (Index >= 0)
+		const FChunkInfo<T>* Chunk = this->FindChunk(Key);
+		if (Chunk != nullptr)
 		{
-			return this->ChunkList[Index].Data;
+			return Chunk->Data;
 		}
 		return nullptr;
 	}
@@ -19,6 +19,7 @@ namespace Api
 	class Group;
 	class User;
 	class UserProfile;
+	class UserResolver;
 	class Category;
 	class Entitlement;
 	class Order;
@@ -50,6 +51,7 @@ namespace Api
 	class HeartBeat;
 	class StoreDisplay;
 	class GDPR;
+	class Prefetch;
 }
 
 namespace GameServerApi
@@ -85,6 +87,7 @@ public:
 	static ServerCredentials ServerCredentials;
 	static Api::User User;
 	static Api::UserProfile UserProfile;
+	static Api::UserResolver UserResolver;
 	static Api::Category Category;
 	static Api::Entitlement Entitlement;
 	static Api::Group Group;
@@ -117,6 +120,7 @@ public:
 	static Api::HeartBeat HeartBeat;
 	static Api::StoreDisplay StoreDisplay;
 	static Api::GDPR GDPR;
+	static Api::Prefetch Prefetch;
 	static GameServerApi::ServerOauth2 ServerOauth2;
 	static GameServerApi::ServerDSM ServerDSM;
 	static GameServerApi::ServerStatistic ServerStatistic;
@@ -40,7 +40,10 @@ public:
 	{
 		switch (State)
 		{
-		case EState::Running: State = EState::CancelRequested;
+		case EState::Running:
+			State = EState::CancelRequested;
+			CancelRequestedDelegate.ExecuteIfBound();
+			break;
 		case EState::CancelRequested:
 		case EState::Cancelled:
 		case EState::Done:
@@ -78,6 +81,11 @@ public:
 		}
 	}
 
+	/**
+	 * @brief Delegate executed once when the cancellation is requested.
+	 */
+	FSimpleDelegate& OnCancelRequested() { return CancelRequestedDelegate; }
+
 private:
 	enum class EState
 	{
@@ -95,7 +103,7 @@ private:
 	};
 
 	EState State;
-	
+	FSimpleDelegate CancelRequestedDelegate;
 };
 
 typedef TSharedPtr<FAccelByteCancellationTokenSource, ESPMode::ThreadSafe> FAccelByteCancellationTokenPtr;
@@ -166,6 +174,7 @@ class FAccelByteTask;
 
 typedef TSharedPtr<FAccelByteTask, ESPMode::ThreadSafe> FAccelByteTaskPtr;
 typedef TSharedRef<FAccelByteTask, ESPMode::ThreadSafe> FAccelByteTaskRef;
+typedef TWeakPtr<FAccelByteTask, ESPMode::ThreadSafe> FAccelByteTaskWeakPtr;
 
 /**
  * Base class for AccelByte Task that can be used in one of the schedulers
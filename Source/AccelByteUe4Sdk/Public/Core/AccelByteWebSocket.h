@@ -51,6 +51,9 @@ public:
 	DECLARE_MULTICAST_DELEGATE_OneParam(FMessageReceiveDelegate, const FString&)
 	DECLARE_MULTICAST_DELEGATE_OneParam(FConnectionErrorDelegate, const FString&)
 	DECLARE_MULTICAST_DELEGATE_ThreeParams(FConnectionCloseDelegate, const int32, const FString&, const bool)
+	DECLARE_MULTICAST_DELEGATE_OneParam(FSendQueueFullDelegate, const bool)
+	DECLARE_MULTICAST_DELEGATE_OneParam(FMessageSupersededDelegate, const FString&)
+	DECLARE_MULTICAST_DELEGATE_OneParam(FMessageDroppedDelegate, const FString&)
 	
 	AccelByteWebSocket(
 		const Credentials& Credentials,
@@ -75,11 +78,34 @@ public:
 	FConnectionErrorDelegate& OnConnectionError();
 	FConnectionCloseDelegate& OnConnectionClosed();
 
+	/**
+	 * Broadcast with true when the queued outbound messages go over the max queued bytes, and with false once they
+	 * are back under it. The messages are still queued, the caller is expected to slow down.
+	 */
+	FSendQueueFullDelegate& OnSendQueueFull();
+
+	/**
+	 * Broadcast with a queued message that was replaced by a newer one with the same coalescing key, and won't be sent.
+	 */
+	FMessageSupersededDelegate& OnMessageSuperseded();
+
+	/**
+	 * Broadcast with each queued message that is dropped without being sent, when the connection is set up again or closed.
+	 */
+	FMessageDroppedDelegate& OnMessageDropped();
+
 	void Reconnect();
 
 	FTickerDelegate TickerDelegate;
 	FDelegateHandleAlias TickerDelegateHandle;
 
+	/**
+	 * Delivers the received messages and connection events as soon as the next frame, instead of with the state
+	 * tick every TickPeriod. Set with [AccelByteWebSocket] bLowLatencyMessageDelivery, enabled by default.
+	 */
+	FTickerDelegate MessageTickerDelegate;
+	FDelegateHandleAlias MessageTickerDelegateHandle;
+
 	static TSharedPtr<AccelByteWebSocket, ESPMode::ThreadSafe> Create(
 		const FString& Url,
 		const FString& Protocol,
@@ -113,7 +139,34 @@ public:
 	void Disconnect(bool ForceCleanup = false);
 	bool IsConnected() const;
 	void SendPing() const;
-	void Send(const FString& Message) const;
+
+	/**
+	 * Send a message right away, or queue it behind the other outbound messages and the send rate limit.
+	 * A message sent while the connection is down is queued until it is connected, or dropped on disconnect.
+	 */
+	void Send(const FString& Message);
+
+	/**
+	 * Send a message right away, or queue it, the queue is flushed on the next message tick.
+	 *
+	 * @param CoalescingKey A message supersedes the queued message with the same key, e.g. a newer presence update.
+	 * Empty to never coalesce.
+	 */
+	void Send(const FString& Message, const FString& CoalescingKey);
+
+	/**
+	 * Limit the outbound messages with a token bucket. Zero messages per second, the default, disables the limit.
+	 */
+	void SetSendRateLimit(float MessagesPerSecond, int32 Burst);
+
+	/**
+	 * Set how many bytes, in UTF-8, can be queued before OnSendQueueFull is broadcast. Zero disables the signal.
+	 */
+	void SetMaxQueuedSendBytes(int32 MaxBytes);
+
+	int32 GetSendQueueNum() const { return SendQueueNum; }
+	int32 GetSendQueueBytes() const { return SendQueueBytes; }
+	bool IsSendQueueFull() const { return bIsSendQueueFull; }
 	
 private:
 	bool bConnectTriggered {false};
@@ -126,8 +179,34 @@ private:
 	FMessageReceiveDelegate MessageReceiveDelegate;
 	FConnectionErrorDelegate ConnectionErrorDelegate;
 	FConnectionCloseDelegate ConnectionCloseDelegate;
+	FSendQueueFullDelegate SendQueueFullDelegate;
+	FMessageSupersededDelegate MessageSupersededDelegate;
+	FMessageDroppedDelegate MessageDroppedDelegate;
+
+	struct FOutboundMessage
+	{
+		FString Message;
+
+		// The content of a keyed message is in QueuedMessagesByKey, so the latest one is sent
+		FString CoalescingKey;
+	};
+
+	TQueue<FOutboundMessage> SendQueue;
+	TMap<FString, FString> QueuedMessagesByKey;
+	int32 SendQueueNum {0};
+	int32 SendQueueBytes {0};
+	int32 MaxQueuedSendBytes {1024 * 1024};
+	bool bIsSendQueueFull {false};
+	float SendRateLimit {0.0f};
+	int32 SendBurst {1};
+	double SendTokens {0.0};
+	double LastSendTokenTime {0.0};
 
 	const float TickPeriod {0.5f};
+	bool bLowLatencyMessageDelivery {true};
+
+	// Zero drains the queues every frame
+	float MessageTickPeriod {0.0f};
 	double TimeSinceLastPing {0.0f};
 	float TimeSinceLastReconnect {0.0f};
 	float TimeSinceConnectionLost {0.0f};
@@ -163,6 +242,9 @@ private:
 	EWebSocketEvent WsEvents;
 
 	void SetupWebSocket();
+	void LoadConfig();
+	void StartTickers();
+	void StopTickers();
 	bool Tick(float DeltaTime);
 	void OnConnectionConnected();
 	void OnConnectionError(const FString& Error);
@@ -173,6 +255,11 @@ private:
 	
 	bool StateTick(float DeltaTime);
 	bool MessageTick(float DeltaTime);
+	bool LowLatencyMessageTick(float DeltaTime);
+	bool TryTakeSendToken();
+	void SendTick();
+	void EmptySendQueue();
+	void UpdateSendQueueFull();
 
 	AccelByteWebSocket(AccelByteWebSocket const&) = delete; // Copy constructor
 	AccelByteWebSocket(AccelByteWebSocket&&) = delete; // Move constructor
@@ -106,6 +106,12 @@ namespace GameServerApi
 		 */
 		void SetOptionalMetricsEnabled(bool Enable);
 
+		/**
+		 * @brief Set Sending the HTTP cache counters with the optional metrics or not
+		 * @param Enable
+		 */
+		void SetHttpCacheMetricsEnabled(bool Enable);
+
 		/**
 		 * @brief Set the StatsD Metric Collector.
 		 * By default it will use AccelByteStatsDMetricCollector class.
@@ -147,6 +153,7 @@ namespace GameServerApi
 		const FString SocketDescription = "Metric Exporter";
 		int32 SendBufferSize = 1 << 16;
 		bool bOptionalMetricsEnabled = true;
+		bool bHttpCacheMetricsEnabled = false;
 	};
 }
 }
\ No newline at end of file
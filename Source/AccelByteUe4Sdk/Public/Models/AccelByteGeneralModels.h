@@ -104,11 +104,62 @@ struct ACCELBYTEUE4SDK_API FAccelByteLRUHttpStruct
 	FString ExpireTime{};
 };
 
+// Caching directives of a response, parsed once when the response is stored
+struct FAccelByteHttpCachePolicy
+{
+	// Cache-Control max-age in seconds, -1 if absent
+	int32 MaxAge{ -1 };
+
+	// Seconds the response has been in a proxy cache (Age header)
+	int32 Age{ 0 };
+
+	// Seconds between the Date and Expires headers, -1 if absent or invalid
+	int32 ExpiresIn{ -1 };
+
+	// Seconds after expiry the response can still be served while it is revalidated in background, -1 if absent
+	int32 StaleWhileRevalidate{ -1 };
+
+	// Seconds after expiry the response can still be served when the request fails, -1 if absent
+	int32 StaleIfError{ -1 };
+
+	uint8 bHasCacheControl : 1;
+	uint8 bNoCache : 1;
+	uint8 bNoStore : 1;
+	uint8 bMustRevalidate : 1;
+	uint8 bImmutable : 1;
+	uint8 bPrivate : 1;
+	uint8 bPublic : 1;
+
+	// Value of the ETag header, sent back as If-None-Match to revalidate
+	FString ETag{};
+
+	FAccelByteHttpCachePolicy()
+		: bHasCacheControl(false)
+		, bNoCache(false)
+		, bNoStore(false)
+		, bMustRevalidate(false)
+		, bImmutable(false)
+		, bPrivate(false)
+		, bPublic(false)
+	{
+	}
+
+	// Seconds the response stays fresh after it is received
+	int32 GetFreshnessLifetime() const
+	{
+		const int32 Lifetime = MaxAge >= 0 ? MaxAge : (ExpiresIn >= 0 ? ExpiresIn : 0);
+		return FMath::Max(Lifetime - Age, 0);
+	}
+};
+
 struct FAccelByteHttpCacheItem
 {
 	// Platform time until cached response is stale (in seconds)
 	double ExpireTime{ 0.0f };
 
+	// Caching directives of the cached response
+	FAccelByteHttpCachePolicy Policy{};
+
 	// Completed request with valid response
 	FHttpRequestPtr Request = nullptr;
 
@@ -121,4 +172,13 @@ struct FRequestBucket
 	int32 AvailableToken {0};
 
 	double ResetTokenTime{ 0.0f };
+
+	// Tokens given on every reset, resolved from the route rate limit configuration
+	int32 TokenLimit{ 0 };
+
+	// Platform time of the last request going through this bucket, used to evict idle bucket
+	double LastAccessTime{ 0.0f };
+
+	// Platform time until the server asked to stop sending requests to the route (429 / Retry-After)
+	double ThrottledUntilTime{ 0.0f };
 };
\ No newline at end of file
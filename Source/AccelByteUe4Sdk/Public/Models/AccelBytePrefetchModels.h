@@ -0,0 +1,47 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief GET request sent after login so its response is in the HTTP cache before it is needed.
+ */
+struct ACCELBYTEUE4SDK_API FAccelByteModelsPrefetchEntry
+{
+	/** @brief Name reported in the warm event */
+	FString Name{};
+
+	/**
+	 * @brief URL of the request, with the same query parameters as the API call it warms up.
+	 * The {namespace}, {publisherNamespace} and {userId} placeholders are replaced by the logged in user's,
+	 * and {platformServerUrl}, {statisticServerUrl}, {achievementServerUrl}, {agreementServerUrl}, {cloudSaveServerUrl},
+	 * {basicServerUrl} and {leaderboardServerUrl} by the settings.
+	 */
+	FString Url{};
+};
+
+struct ACCELBYTEUE4SDK_API FAccelByteModelsPrefetchEntryResult
+{
+	FString Name{};
+	bool bSucceeded{false};
+	int32 ErrorCode{0};
+
+	/** @brief Seconds from the start of the prefetch until the response */
+	double ElapsedSeconds{0.0};
+};
+
+/**
+ * @brief Reported once every entry of the manifest got its response.
+ */
+struct ACCELBYTEUE4SDK_API FAccelByteModelsPrefetchWarmEvent
+{
+	TArray<FAccelByteModelsPrefetchEntryResult> Results{};
+
+	/** @brief Seconds from the start of the prefetch until the last response, the longest round trip */
+	double ElapsedSeconds{0.0};
+
+	int32 SucceededNum{0};
+};